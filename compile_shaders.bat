@@ -9,6 +9,8 @@ if not defined VULKAN_SDK (
 
 set GLSLC=%VULKAN_SDK%\Bin\glslc.exe
 
+rem CMake compiles the same files with the same flags into build\spv when glslc is found.
+rem This spv\ is the fallback it uses when the Vulkan SDK is not installed.
 set OUT_DIR=spv
 if not exist %OUT_DIR% mkdir %OUT_DIR%
 
@@ -17,6 +19,11 @@ echo [INFO] .vert, .frag, .comp, .rgen, .rchit, .rmiss shaders are being compile
 for %%f in (shaders\*.vert shaders\*.frag shaders\*.comp shaders\*.rgen shaders\*.rchit shaders\*.rmiss ) do (
     echo Compiling %%~nxf ...
     "%GLSLC%" "%%f" -o "%OUT_DIR%\%%~nxf.spv" --target-env=vulkan1.2
+    if errorlevel 1 (
+        echo [ERROR] failed to compile %%~nxf
+        pause
+        exit /b 1
+    )
 )
 
 echo [INFO] All shaders compiled!
@@ -35,12 +35,12 @@ private:
 class TopLevelAS : public AccelerationStructure {
 public:
 	static std::unique_ptr<TopLevelAS> createTopLevelAS(VulkanContext* context, std::vector<std::unique_ptr<BottomLevelAS>>& blasList,
-		std::vector<InstanceGPU>& instanceList);
+		std::vector<InstanceGPU>& instanceList, std::vector<glm::mat4>& transformList);
 	// static std::unique_ptr<TopLevelAS> createEmptyTopLevelAS(VulkanContext* context);
 	void recreate(std::vector<std::unique_ptr<BottomLevelAS>>& blasList,
-		std::vector<InstanceGPU>& instanceList);
+		std::vector<InstanceGPU>& instanceList, std::vector<glm::mat4>& transformList);
 private:
 	void initTLAS(VulkanContext* context, std::vector<std::unique_ptr<BottomLevelAS>>& blasList,
-		std::vector<InstanceGPU>& instanceList);
+		std::vector<InstanceGPU>& instanceList, std::vector<glm::mat4>& transformList);
 	// void initEmptyTLAS(VulkanContext* context);
 };
\ No newline at end of file
@@ -5,13 +5,14 @@
 
 class App {
 public:
-	App();
+	App(const HeadlessSettings& settings);
 	~App();
 	void run();
 
 private:
 	std::unique_ptr<Window> m_window;
 	std::unique_ptr<Renderer> m_renderer;
+	HeadlessSettings m_settings;	// 명령행 옵션 (camera path 등)
 
 	void init();
 	void cleanup();
@@ -23,7 +23,7 @@ protected:
     VkDeviceMemory m_bufferMemory;
 
     void createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer &buffer,
-					  VkDeviceMemory &bufferMemory);
+					  VkDeviceMemory &bufferMemory, MemoryCategory category = MemoryCategory::Auto);
     void copyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size);
 };
 
@@ -56,6 +56,7 @@ class ImageBuffer : public Buffer {
 public:
 	static std::unique_ptr<ImageBuffer> createImageBuffer(VulkanContext* context, std::string path, VkFormat format);
 	static std::unique_ptr<ImageBuffer> createHDRImageBuffer(VulkanContext* context, std::string path);
+	static std::unique_ptr<ImageBuffer> createHDRImageBufferFromMemory(VulkanContext* context, const float* rgba, uint32_t width, uint32_t height);
 	static std::unique_ptr<ImageBuffer> createDefaultImageBuffer(VulkanContext* context, glm::vec4 color);
 	static std::unique_ptr<ImageBuffer> createAttachmentImageBuffer(VulkanContext* context, uint32_t width,
 		uint32_t height, VkFormat format, VkImageUsageFlags usage, VkImageAspectFlags aspectFlags);
@@ -79,6 +80,7 @@ private:
 
 	bool init(VulkanContext* context, std::string path, VkFormat format);
 	bool initHDR(VulkanContext* context, std::string path);
+	void initHDRFromMemory(VulkanContext* context, const float* rgba, uint32_t width, uint32_t height);
 	void initDefault(VulkanContext* context, glm::vec4 color);
 	void initAttachment(VulkanContext* context, uint32_t width,
 		uint32_t height, VkFormat format, VkImageUsageFlags usage, VkImageAspectFlags aspectFlags);
@@ -106,8 +108,11 @@ private:
 class StorageBuffer : public Buffer {
 public:
 	static std::unique_ptr<StorageBuffer> createStorageBuffer(VulkanContext* context, VkDeviceSize buffersize, size_t count);
+	// GPU 전용 (map 안 됨), 자주 atomic 으로 쓰는 버퍼용. 읽을 땐 host StorageBuffer 로 copy
+	static std::unique_ptr<StorageBuffer> createDeviceLocalStorageBuffer(VulkanContext* context, VkDeviceSize buffersize, size_t count);
 	~StorageBuffer();
 	VkDeviceSize getCurrentSize() { return m_currentSize; }
+	void* getMappedMemory() { return m_mappedMemory; }
 
 	void updateStorageBuffer(void* data, VkDeviceSize totalSize);
 	void updateStorageBufferAt(uint32_t index, void* data, VkDeviceSize structSize);
@@ -118,6 +123,6 @@ private:
 	void* m_mappedMemory = nullptr;
 	VkDeviceSize m_currentSize = 0;
 
-	void init(VulkanContext* context, VkDeviceSize buffersize, size_t count);
+	void init(VulkanContext* context, VkDeviceSize buffersize, size_t count, bool deviceLocal = false);
 	void cleanup();
 };
\ No newline at end of file
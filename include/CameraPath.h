@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Common.h"
+
+struct CameraKeyframe {
+	float time = 0.0f;		// 초
+	glm::vec3 position = glm::vec3(0.0f);
+	float yaw = -90.0f;		// Renderer::update 와 같은 정의 (degree)
+	float pitch = 0.0f;
+	float fovY = 50.0f;
+};
+
+// playback 중 한 프레임의 기록
+struct CameraPathFrame {
+	int32_t frame = 0;
+	float time = 0.0f;		// path 위의 시간
+	double frameMs = 0.0;	// 이전 프레임부터의 wall time
+	double gpuMs = 0.0;		// GPU timestamp (interactive 는 GPU_PROFILER_LATENCY 프레임 지연)
+	int32_t spp = 0;		// 이 프레임까지 누적된 sample 수 (움직이는 동안은 1)
+};
+
+// 텍스트 파일, 한 줄에 keyframe 하나: time x y z yaw pitch fov ('#' 이후는 주석)
+// 재생은 고정 time step (1 / fps) 으로 진행해서 매번 같은 camera 순서가 나온다
+class CameraPath {
+public:
+	static std::unique_ptr<CameraPath> createCameraPath(const std::string& path);
+
+	CameraKeyframe evaluate(float time) const;	// keyframe 사이는 선형 보간
+	float getDuration() const { return m_keyframes.back().time; }
+	uint32_t getFrameCount(float fps) const;
+
+	static glm::vec3 getDirection(float yaw, float pitch);
+	static void writeFrameTimings(const std::string& path, const std::vector<CameraPathFrame>& frames);
+
+private:
+	std::vector<CameraKeyframe> m_keyframes;
+
+	void init(const std::string& path);
+};
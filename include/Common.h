@@ -40,12 +40,73 @@
 
 const int MAX_FRAMES_IN_FLIGHT = 1;
 constexpr uint32_t MAX_LIGHT_COUNT = 64;
+constexpr uint32_t MAX_EMISSIVE_TRIANGLE_COUNT = 65536;	// 넘으면 남은 instance 는 NEE 에서 빠짐 (hit 시 emission 은 그대로)
+
+// environment map importance sampling: 분포는 가로 최대 이 크기의 cell 로 (box filter) 줄여서 만듦
+constexpr uint32_t ENVIRONMENT_DISTRIBUTION_MAX_WIDTH = 1024;
+constexpr float ENVIRONMENT_SELECT_PROB = 0.5f;	// 다른 light 가 있을 때 NEE 가 environment 를 고를 확률
+
+// Owen-scrambled Sobol: 4 차원씩 묶어 쓰고 (padding) 묶음마다 sample index 를 섞음
+constexpr uint32_t SOBOL_DIMENSIONS = 4;
+constexpr uint32_t SOBOL_BITS = 32;
 
 constexpr uint32_t MAX_OBJECT_COUNT = 1000;
 constexpr uint32_t MAX_MESH_COUNT = 10000;
 constexpr uint32_t MAX_MATERIAL_COUNT = 512;
 constexpr uint32_t MAX_TEXTURE_COUNT = 128;
 
+// viewport render target: 버킷 단위로 크게 할당하고 sub-rect 에만 렌더링
+constexpr uint32_t VIEWPORT_BUCKET_SIZE = 256;
+constexpr float VIEWPORT_RESIZE_DEBOUNCE = 0.25f; // seconds
+
+// 목표 spp 에 도달하면 trace 를 멈추고 이벤트가 올 때까지 대기
+constexpr double IDLE_WAIT_TIMEOUT = 0.1; // seconds
+
+// pipeline cache 파일 (device UUID / driver version 이 다르면 무시)
+constexpr const char* PIPELINE_CACHE_PATH = "pipeline_cache.bin";
+
+// accum 은 RGBA32F 하나에 in-place 누적, 출력은 가벼운 포맷
+// (shader 의 outputImage format qualifier 와 같아야 함, VK_FORMAT_R8G8B8A8_UNORM 으로 바꾸면 rgba8 로)
+constexpr VkFormat ACCUM_IMAGE_FORMAT = VK_FORMAT_R32G32B32A32_SFLOAT;
+constexpr VkFormat OUTPUT_IMAGE_FORMAT = VK_FORMAT_R16G16B16A16_SFLOAT;
+
+// GPU timestamp profiler: LATENCY 프레임 전의 query 를 읽어서 stall 없음
+constexpr uint32_t GPU_PROFILER_LATENCY = 3;
+constexpr uint32_t GPU_PROFILER_MAX_QUERIES = 256; // frame slot 당
+constexpr uint32_t GPU_PROFILER_HISTORY = 120;
+
+// CPU 구간 trace (Chrome trace event JSON)
+constexpr size_t CPU_PROFILER_MAX_EVENTS = 1 << 20;	// ring buffer 크기 (넘으면 오래된 event 부터 덮어씀)
+constexpr const char* CPU_TRACE_PATH = "trace.json";	// Stats 창의 Save Trace
+
+// device memory 분류 (MemoryTracker), Auto 는 buffer / image usage 로 추정
+enum class MemoryCategory : uint32_t {
+	Auto,
+	Geometry,
+	Textures,
+	AccelerationStructure,
+	Scratch,
+	RenderTargets,
+	Staging,
+	Buffers,		// uniform / storage / SBT
+	Count
+};
+
+// ray / path 통계 (raygen 의 최대 bounce 수와 같아야 함)
+constexpr uint32_t RAY_STATS_MAX_DEPTH = 16;
+
+// adaptive sampling: tile 단위로 수렴 판정 (raygen 과 같아야 함)
+constexpr uint32_t ADAPTIVE_TILE_SIZE = 16;
+constexpr uint32_t ADAPTIVE_TILE_SLOTS = 3;		// sample 마다 read / write / clear slot 순환
+constexpr int32_t ADAPTIVE_MIN_SPP_LIMIT = 4;	// slot 이 한 바퀴 돌기 전의 값은 쓰지 않음
+
+// golden image 비교: relMSE 분모의 epsilon, time-to-error 곡선은 spp 가 2 배가 될 때마다 측정
+constexpr double IMAGE_REL_MSE_EPSILON = 1e-2;
+
+// offline tile 렌더링: 큰 해상도는 tile 단위로 trace 해서 파일에 바로 기록
+constexpr uint32_t OFFLINE_TILE_SIZE = 1024;
+constexpr uint64_t OFFLINE_TILE_AUTO_PIXELS = 4096ull * 4096ull; // 이보다 크면 tileSize 를 안 줘도 tile 렌더링
+
 // Ray Tracing Acceleration Structure
 extern PFN_vkCreateAccelerationStructureKHR g_vkCreateAccelerationStructureKHR;
 extern PFN_vkDestroyAccelerationStructureKHR g_vkDestroyAccelerationStructureKHR;
@@ -58,6 +119,10 @@ extern PFN_vkCreateRayTracingPipelinesKHR g_vkCreateRayTracingPipelinesKHR;
 extern PFN_vkGetRayTracingShaderGroupHandlesKHR g_vkGetRayTracingShaderGroupHandlesKHR;
 extern PFN_vkCmdTraceRaysKHR g_vkCmdTraceRaysKHR;
 
+// VK_EXT_debug_utils command label (지원 안 하면 nullptr)
+extern PFN_vkCmdBeginDebugUtilsLabelEXT g_vkCmdBeginDebugUtilsLabelEXT;
+extern PFN_vkCmdEndDebugUtilsLabelEXT g_vkCmdEndDebugUtilsLabelEXT;
+
 inline VkTransformMatrixKHR glmToVkTransform(const glm::mat4& mat) {
 	VkTransformMatrixKHR out{};
 	for (int i = 0; i < 3; ++i) {
@@ -113,6 +178,12 @@ VkResult CreateDebugUtilsMessengerEXT(VkInstance instance, const VkDebugUtilsMes
 
 void DestroyDebugUtilsMessengerEXT(VkInstance instance, VkDebugUtilsMessengerEXT debugMessenger, const VkAllocationCallbacks* pAllocator);
 
+// nearest-rank percentile (p: 0 ~ 1), sorted 는 오름차순이고 비어 있지 않아야 함 (benchmark, camera path 측정)
+double percentile(const std::vector<double>& sorted, double p);
+
+// JSON 문자열 값 (따옴표 / backslash escape, 제어 문자는 공백으로)
+std::string escapeJson(const std::string& value);
+
 struct Vertex {
 	// glm::vec3 pos;
 	// glm::vec3 normal;
@@ -222,6 +293,69 @@ struct alignas(16) OptionsGPU {
 	int maxSpp = 99999;
 	int currentSpp = -1;
 	int lightCount = 0;
+
+	// adaptive sampling (tile 의 최대 상대 오차가 adaptiveError 이하면 더 이상 trace 안 함)
+	int adaptive = 0;
+	float adaptiveError = 0.02f;
+	int adaptiveMinSpp = 16;
+
+	// next-event estimation: quad light / emissive triangle 중 어느 쪽을 고를지
+	int emissiveTriangleCount = 0;
+	float areaLightSelectProb = 1.0f;	// 두 집합의 power 비율
+
+	// equirectangular HDR environment (environmentTexIndex < 0 이면 없음)
+	int environmentTexIndex = -1;
+	float environmentIntensity = 1.0f;
+	int environmentDistWidth = 0;		// cell alias table 의 해상도
+	int environmentDistHeight = 0;
+	float environmentSelectProb = 0.0f;	// NEE 가 environment 를 고를 확률 (나머지는 quad / triangle)
+	int pad0 = 0;
+	int pad1 = 0;
+};
+
+// 매 프레임 바뀌는 값은 push constant 로 전달 (ray tracing pipeline layout, shaders/frameData.glsl 과 같아야 함)
+struct alignas(16) FramePushConstants {
+	glm::vec3 camPos = glm::vec3(0.0f);
+	int frameCount = 0;
+	glm::vec3 camDir = glm::vec3(0.0f, 0.0f, -1.0f);
+	int currentSpp = 0;
+	glm::vec3 camUp = glm::vec3(0.0f, 1.0f, 0.0f);
+	float pad0 = 0.0f;
+	glm::vec3 camRight = glm::vec3(1.0f, 0.0f, 0.0f);
+	float fovY = 50.0f;
+	glm::uvec2 tileOffset = glm::uvec2(0);	// launch id + tileOffset = 전체 이미지의 pixel
+	glm::uvec2 imageSize = glm::uvec2(0);	// 전체 이미지 크기 (tile 이 아니면 trace 크기와 같음)
+};
+
+// shader atomic counter (specialization constant 로 꺼지면 shader 에서 제거됨)
+struct RayStatsGPU {
+	uint32_t pathLengths[RAY_STATS_MAX_DEPTH];	// [k]: ray 를 정확히 k + 1 개 trace 한 path 수
+	uint32_t shadowRays;
+	uint32_t rouletteKills;
+	uint32_t missTerminations;
+	uint32_t lightHits;
+};
+
+struct RayStats {
+	bool enabled = false;
+
+	// 마지막으로 읽은 프레임
+	std::array<uint64_t, RAY_STATS_MAX_DEPTH> depthRays{};	// [d]: depth d 에서 trace 된 ray 수 (0: primary)
+	uint64_t shadowRays = 0;
+	uint64_t rouletteKills = 0;
+	uint64_t missTerminations = 0;
+	uint64_t lightHits = 0;
+	uint64_t frameRays = 0;
+	double raysPerSecond = 0.0;
+
+	uint64_t accumulatedRays = 0;	// resetRayStats() 이후 누적
+};
+
+struct AdaptiveStats {
+	int32_t sampleCount = -1;	// 아래 값을 읽은 시점의 누적 sample 수
+	uint32_t activeTiles = 0;	// 상대 오차가 목표보다 큰 tile 수
+	uint32_t tileCount = 0;
+	float maxError = 0.0f;
 };
 
 struct AreaLight {
@@ -243,11 +377,11 @@ struct alignas(16) AreaLightGPU {
 	glm::vec3 p0 = glm::vec3(0.0f);
 	float area = 1.0f;
 	glm::vec3 p1 = glm::vec3(0.0f);
-	float pad0 = 0.0f;
+	float aliasProb = 1.0f;		// light 선택 alias table: 이 slot 을 그대로 쓸 확률
 	glm::vec3 p2 = glm::vec3(0.0f);
-	float pad1 = 0.0f;
+	int32_t aliasIndex = 0;		// 아니면 이 light
 	glm::vec3 p3 = glm::vec3(0.0f);
-	float pad2 = 0.0f;
+	float selectPdf = 1.0f;		// 이 light 가 선택될 확률 (power 비례)
 	glm::vec3 normal = glm::vec3(0.0f, 1.0f, 0.0f);
 	float pad3 = 0.0f;
 };
@@ -261,8 +395,10 @@ struct Object {
 	int overrideMaterialIndex = -1;
 };
 
+// hit shader 가 읽는 instance 정보. 위치 변환은 shader 의 gl_ObjectToWorldEXT,
+// TLAS 용 object -> world 변환은 Renderer::m_instanceTransforms 에 따로 둔다
 struct alignas(16) InstanceGPU {
-	glm::mat4 transform = glm::mat4(1.0f);
+	glm::mat3x4 normalMatrix = glm::mat3x4(1.0f);	// transpose(inverse(mat3(transform))) 을 미리 계산 (열 3 개, w 는 안 씀)
 
 	uint64_t vertexAddress = 0;
 	uint64_t indexAddress = 0;
@@ -270,9 +406,77 @@ struct alignas(16) InstanceGPU {
 	int lightIndex = -1;
 	int materialIndex = -1;
 	int meshIndex = -1;
+	int emissiveTriangleOffset = -1;	// emissive triangle list 에서 이 instance 의 첫 triangle (+ gl_PrimitiveID)
+};
+
+// emissive material 의 triangle (world space), power 비례 alias table 포함
+struct alignas(16) EmissiveTriangleGPU {
+	glm::vec3 p0 = glm::vec3(0.0f);
+	float area = 0.0f;
+	glm::vec3 p1 = glm::vec3(0.0f);
+	int32_t materialIndex = -1;		// emissiveFactor / emissiveTexIndex / doubleSided
+	glm::vec3 p2 = glm::vec3(0.0f);
+	float aliasProb = 1.0f;
+	glm::vec2 uv0 = glm::vec2(0.0f);
+	glm::vec2 uv1 = glm::vec2(0.0f);
+	glm::vec2 uv2 = glm::vec2(0.0f);
+	int32_t aliasIndex = 0;
+	float selectPdf = 1.0f;			// triangle 집합 안에서의 선택 확률
+};
+
+// environment map 의 cell (luminance x sin(theta) 비례 alias table)
+struct alignas(16) EnvironmentCellGPU {
+	float aliasProb = 1.0f;
+	int32_t aliasIndex = 0;
+	float selectPdf = 1.0f;
 	float pad0 = 0.0f;
 };
 
+// headless (offline) 렌더링 설정. command line 에서 채운다.
+struct HeadlessSettings {
+	uint32_t width = 1280;
+	uint32_t height = 720;
+	int32_t spp = 256;
+	int32_t samplesPerSubmit = 8;	// 한 번의 submit 에 누적할 sample 수 (TDR 방지)
+	std::string scene = "default";
+	std::string modelPath = "";		// 추가로 로드해서 배치할 glTF
+	glm::vec3 modelPosition = glm::vec3(0.0f);
+	float modelScale = 1.0f;
+	std::string environmentPath = "";	// equirectangular .hdr / .pfm (interactive / headless 둘 다)
+	float environmentIntensity = 1.0f;
+	std::string outputPath = "output.png";
+	std::string tracePath = "";		// 비어 있지 않으면 종료 시 CPU trace 저장 (headless 가 아니어도 사용)
+	uint32_t tileSize = 0;			// 0: 해상도가 OFFLINE_TILE_AUTO_PIXELS 를 넘을 때만 OFFLINE_TILE_SIZE 로 tile 렌더링
+	int32_t seed = 0;				// 첫 sample 의 frameCount
+
+	// camera path 재생 (cameraPath 가 비어 있지 않으면 사용, interactive / headless 둘 다)
+	std::string cameraPath = "";
+	std::string cameraPathOutput = "camera_path.csv";
+	float cameraPathFps = 60.0f;	// 고정 time step
+
+	// golden image 비교 (goldenPath 가 비어 있지 않으면 사용)
+	std::string goldenPath = "";
+	double goldenTolerance = 0.0;	// 최종 relMSE 허용치, 0 이면 결과만 출력
+	std::string errorCurvePath = "";	// spp, 초, RMSE, relMSE 를 CSV 로 기록
+
+	// benchmark
+	bool benchmark = false;
+	int32_t warmupFrames = 16;
+	int32_t benchmarkFrames = 128;
+	int32_t sppPerFrame = 1;
+	std::string benchmarkOutput = "benchmark.json";
+	bool rayStats = false;
+
+	// adaptive sampling (adaptiveError > 0 이면 사용)
+	float adaptiveError = 0.0f;
+	int32_t adaptiveMinSpp = 16;
+
+	bool overrideCamera = false;
+	glm::vec3 camPos = glm::vec3(0.0f, 0.0f, 5.0f);
+	glm::vec3 camDir = glm::vec3(0.0f, 0.0f, -1.0f);
+	float fovY = 50.0f;
+};
+
 struct Scene {
 	std::vector<Object> objects;
 	std::vector<AreaLight> areaLights;
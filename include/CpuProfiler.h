@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Common.h"
+#include <atomic>
+#include <mutex>
+
+// CPU 구간 기록 → Chrome trace event JSON (chrome://tracing, Perfetto 에서 열기)
+// context 가 생기기 전부터 쓰므로 전역 (static) 으로 둔다
+// 기본은 꺼짐 (--trace 나 Stats 창의 Record 로 켬), 꺼져 있으면 Scope 는 flag 만 확인
+class CpuProfiler {
+public:
+	// 생성 시 시작, 소멸 시 event 하나 기록 (name 은 복사하지 않으므로 문자열 literal 만)
+	class Scope {
+	public:
+		Scope(const char* name);
+		~Scope();
+	private:
+		const char* m_name;
+		int64_t m_startUs;		// 생성 시 꺼져 있었으면 -1
+	};
+
+	static void setEnabled(bool enabled);
+	static bool isEnabled();
+	static void clear();
+	static void writeTrace(const std::string& path);	// 지금까지의 event 를 저장 (계속 기록됨)
+	static size_t getEventCount();
+
+private:
+	struct Event {
+		const char* name;
+		int64_t startUs;
+		int64_t durationUs;
+		uint32_t threadId;
+	};
+
+	static std::mutex s_mutex;
+	static std::vector<Event> s_events;		// ring buffer: CPU_PROFILER_MAX_EVENTS 개가 차면 가장 오래된 event 를 덮어씀
+	static size_t s_nextEvent;				// 다음에 쓸 자리 (가득 찼으면 가장 오래된 event)
+	static std::atomic<bool> s_enabled;
+
+	static int64_t nowUs();
+	static uint32_t getThreadId();
+	static void addEvent(const char* name, int64_t startUs, int64_t endUs);
+};
@@ -9,18 +9,19 @@
 class DescriptorSet {
 public:
 	static std::unique_ptr<DescriptorSet> createSet0DescSet(VulkanContext* context, DescriptorSetLayout* layout,
-		UniformBuffer* cameraBuffer, UniformBuffer* optionsBuffer);
+		UniformBuffer* optionsBuffer, StorageBuffer* rayStatsBuffer, StorageBuffer* sobolBuffer);
 	static std::unique_ptr<DescriptorSet> createSet1DescSet(VulkanContext* context, DescriptorSetLayout* layout,
 		StorageBuffer* materialBuffer);
 	static std::unique_ptr<DescriptorSet> createSet2DescSet(VulkanContext* context, DescriptorSetLayout* layout,
 		std::vector<std::unique_ptr<Texture>>& textures);
 	static std::unique_ptr<DescriptorSet> createSet3DescSet(VulkanContext* context, DescriptorSetLayout* layout,
-		StorageBuffer* instanceBuffer, StorageBuffer* areaLightBuffer);
+		StorageBuffer* instanceBuffer, StorageBuffer* areaLightBuffer, StorageBuffer* emissiveTriangleBuffer,
+		StorageBuffer* environmentBuffer);
 	VkDescriptorSet& getDescriptorSet() { return m_descriptorSet; }
 	static std::unique_ptr<DescriptorSet> createSet4DescSet(VulkanContext* context, DescriptorSetLayout* layout,
 		VkAccelerationStructureKHR tlas);
 	static std::unique_ptr<DescriptorSet> createSet5DescSet(VulkanContext* context, DescriptorSetLayout* layout,
-		Texture* output, Texture* accumPrev, Texture* accumCur);
+		Texture* output, Texture* accum, Texture* moment, StorageBuffer* tileError);
 	~DescriptorSet();
 
 private:
@@ -29,15 +30,16 @@ private:
 
 	void cleanup();
 	void initSet0DescSet(VulkanContext* context, DescriptorSetLayout* layout,
-		UniformBuffer* cameraBuffer, UniformBuffer* optionsBuffer);
+		UniformBuffer* optionsBuffer, StorageBuffer* rayStatsBuffer, StorageBuffer* sobolBuffer);
 	void initSet1DescSet(VulkanContext* context, DescriptorSetLayout* layout,
 		StorageBuffer* materialBuffer);
 	void initSet2DescSet(VulkanContext* context, DescriptorSetLayout* layout,
 		std::vector<std::unique_ptr<Texture>>& textures);
 	void initSet3DescSet(VulkanContext* context, DescriptorSetLayout* layout,
-		StorageBuffer* instanceBuffer, StorageBuffer* areaLightBuffer);
+		StorageBuffer* instanceBuffer, StorageBuffer* areaLightBuffer, StorageBuffer* emissiveTriangleBuffer,
+		StorageBuffer* environmentBuffer);
 	void initSet4DescSet(VulkanContext* context, DescriptorSetLayout* layout,
 		VkAccelerationStructureKHR tlas);
 	void initSet5DescSet(VulkanContext* context, DescriptorSetLayout* layout,
-		Texture* output, Texture* accumPrev, Texture* accumCur);
+		Texture* output, Texture* accum, Texture* moment, StorageBuffer* tileError);
 };
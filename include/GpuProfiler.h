@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Common.h"
+#include "VulkanContext.h"
+
+struct GpuZoneStats {
+	std::string name;
+	uint32_t depth = 0;
+	float lastMs = 0.0f;
+	float avgMs = 0.0f;			// 최근 GPU_PROFILER_HISTORY 프레임 평균
+	double totalMs = 0.0;		// resetStats() 이후 누적
+	uint32_t sampleCount = 0;
+	std::array<float, GPU_PROFILER_HISTORY> history{};
+	uint32_t historyOffset = 0;
+	uint32_t historyCount = 0;
+};
+
+// timestamp query pool 기반 GPU 구간 측정 (+ 같은 이름의 VK_EXT_debug_utils label)
+// frame slot 을 GPU_PROFILER_LATENCY 개 돌려 쓰고, slot 을 다시 쓰기 직전에 결과를 읽는다
+class GpuProfiler {
+public:
+	static std::unique_ptr<GpuProfiler> createGpuProfiler(VulkanContext* context);
+	~GpuProfiler();
+
+	// 생성 시 beginZone, 소멸 시 endZone (profiler 가 nullptr 이면 아무것도 안 함)
+	class Scope {
+	public:
+		Scope(GpuProfiler* profiler, VkCommandBuffer cmd, const char* name);
+		~Scope();
+	private:
+		GpuProfiler* m_profiler;
+		VkCommandBuffer m_cmd;
+	};
+
+	void beginFrame();		// frame fence 대기 이후 호출
+	void beginZone(VkCommandBuffer cmd, const char* name);
+	void endZone(VkCommandBuffer cmd);
+	void flush();			// 모든 slot 결과를 기다려서 반영 (idle 상태에서만)
+	void resetStats();
+
+	bool isEnabled() const { return m_enabled; }
+	const std::vector<GpuZoneStats>& getZoneStats() const { return m_zoneStats; }
+	const GpuZoneStats* findZoneStats(const std::string& name) const;
+
+private:
+	struct Zone {
+		std::string name;
+		uint32_t depth;
+		uint32_t beginQuery;
+		uint32_t endQuery;
+	};
+
+	struct FrameSlot {
+		std::vector<Zone> zones;
+		uint32_t queryCount = 0;
+	};
+
+	VulkanContext* context;
+	VkQueryPool m_queryPool = VK_NULL_HANDLE;
+	bool m_enabled = false;
+	float m_timestampPeriod = 1.0f;		// ns / tick
+	uint64_t m_timestampMask = ~0ull;
+
+	std::array<FrameSlot, GPU_PROFILER_LATENCY> m_slots;
+	uint32_t m_currentSlot = 0;
+	std::vector<int32_t> m_openZones;	// 현재 slot 의 zone index (-1: query 부족으로 생략)
+	std::vector<GpuZoneStats> m_zoneStats;
+
+	void init(VulkanContext* context);
+	void cleanup();
+	void resolveSlot(uint32_t slotIndex);
+	void addSample(const std::string& name, uint32_t depth, float ms);
+};
@@ -6,6 +6,7 @@
 #include "SwapChain.h"
 #include "Texture.h"
 #include "VulkanUtil.h"
+#include "CpuProfiler.h"
 
 class GuiRenderer {
 public:
@@ -13,8 +14,9 @@ public:
     ~GuiRenderer();
 
     void newFrame();
-    void render(VkCommandBuffer cmd, OptionsGPU& options, Scene& scene, float deltaTime);
+    void render(VkCommandBuffer cmd, OptionsGPU& options, Scene& scene, GpuProfiler* profiler, RayStats& rayStats, const AdaptiveStats& adaptiveStats, float deltaTime);
     void createViewPortDescriptorSet(std::array<Texture*, 2> textures);
+    void setViewportRegion(VkExtent2D renderExtent, VkExtent2D allocExtent);
     ImVec2 getViewportSize() const { return m_viewportSize; }
 	bool isBenchmarkRunning() const { return m_benchmarkRunning; }
     void updateModel(std::vector<Model>& models);
@@ -38,6 +40,7 @@ private:
 
     bool m_dockLayoutBuilt;
     ImVec2 m_viewportSize;
+    ImVec2 m_viewportUV = ImVec2(1.0f, 1.0f); // render target 중 실제 렌더링된 영역
 
     void init(VulkanContext* context, GLFWwindow* window, RenderPass* renderPass, SwapChain* swapChain);
     void createDescriptorPool();
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Renderer.h"
+
+// window / surface / swapchain / ImGui 없이 offline 렌더링
+class HeadlessApp {
+public:
+	HeadlessApp(const HeadlessSettings& settings);
+	~HeadlessApp();
+	void run();
+
+	static bool parseCommandLine(int argc, char** argv, HeadlessSettings& settings);
+	static void printUsage();
+
+private:
+	HeadlessSettings m_settings;
+	std::unique_ptr<Renderer> m_renderer;
+
+	struct BenchmarkView {
+		std::string name;
+		glm::vec3 camPos;
+		glm::vec3 camDir;
+		float fovY;
+	};
+
+	// default scene + (선택) 추가 glTF, scene 마다 renderer 를 새로 만듦
+	struct BenchmarkScene {
+		std::string name;
+		std::string modelPath;		// 비어 있으면 default scene 만
+		glm::vec3 modelPosition;
+		float modelScale;
+		std::vector<BenchmarkView> views;
+	};
+
+	// scene 의 마지막 view 이후 device memory (MB)
+	struct BenchmarkMemory {
+		std::string scene;
+		std::string modelPath;
+		bool budgetExtension = false;
+		double trackedMB = 0.0;
+		double peakMB = 0.0;
+		std::vector<std::pair<std::string, double>> categoriesMB;
+		std::vector<MemoryHeapStats> heaps;
+	};
+
+	struct BenchmarkResult {
+		std::string scene;
+		std::string view;
+		double meanMs = 0.0;
+		double medianMs = 0.0;
+		double p95Ms = 0.0;
+		double p99Ms = 0.0;
+		double minMs = 0.0;
+		double maxMs = 0.0;
+		double samplesPerSecond = 0.0;
+		double raysPerSecond = 0.0;
+		std::vector<std::pair<std::string, double>> gpuZoneMs;	// GpuProfiler 구간별 평균
+	};
+
+	// time-to-error 곡선의 한 점
+	struct ErrorSample {
+		int32_t spp = 0;
+		double seconds = 0.0;	// trace 시간만 (readback / 비교 제외)
+		ImageError error;
+	};
+
+	void init();
+	void cleanup();
+	void runCameraPath();
+	void runGolden();
+	void writeErrorCurve(const std::vector<ErrorSample>& curve);
+	void runBenchmark();
+	BenchmarkResult benchmarkView(const BenchmarkView& view);
+	BenchmarkMemory collectBenchmarkMemory(const BenchmarkScene& scene);
+	void writeBenchmarkJson(const std::vector<BenchmarkMemory>& scenes, const std::vector<BenchmarkResult>& results);
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Common.h"
+
+struct ImageError {
+	double rmse = 0.0;		// RGB 채널 전체
+	double relMse = 0.0;	// (x - ref)^2 / (ref^2 + IMAGE_REL_MSE_EPSILON) 평균
+};
+
+class ImageIO {
+public:
+	// rgba : linear float, width * height * 4, top-down
+	// 확장자로 포맷 결정 (.png, .hdr, .pfm)
+	static void writeImage(const std::string& path, uint32_t width, uint32_t height, const std::vector<float>& rgba);
+
+	static void writePNG(const std::string& path, uint32_t width, uint32_t height, const std::vector<float>& rgba);
+	static void writeHDR(const std::string& path, uint32_t width, uint32_t height, const std::vector<float>& rgba);
+	static void writePFM(const std::string& path, uint32_t width, uint32_t height, const std::vector<float>& rgba);
+
+	// golden image / environment map 용, float 포맷만 (.pfm, .hdr)
+	static std::vector<float> readImage(const std::string& path, uint32_t& width, uint32_t& height);
+	static std::vector<float> readPFM(const std::string& path, uint32_t& width, uint32_t& height);
+	static ImageError compareImages(const std::vector<float>& rgba, const std::vector<float>& reference);
+
+	static float linearToSRGB(float value);
+};
+
+// 전체 이미지를 메모리에 두지 않고 tile 단위로 파일에 기록
+// 행 크기가 고정인 무압축 포맷만 가능 (.pfm: linear float, .ppm: 8bit sRGB)
+class TiledImageWriter {
+public:
+	static std::unique_ptr<TiledImageWriter> createTiledImageWriter(const std::string& path, uint32_t width, uint32_t height);
+	~TiledImageWriter();
+
+	// rgba : linear float, tileWidth * tileHeight * 4, top-down
+	void writeTile(uint32_t x, uint32_t y, uint32_t tileWidth, uint32_t tileHeight, const std::vector<float>& rgba);
+
+private:
+	std::fstream m_file;
+	std::string m_path;
+	uint32_t m_width = 0;
+	uint32_t m_height = 0;
+	bool m_isFloat = false;
+	uint32_t m_pixelBytes = 0;
+	std::streamoff m_headerSize = 0;
+
+	void init(const std::string& path, uint32_t width, uint32_t height);
+	void cleanup();
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Common.h"
+
+struct MemoryHeapStats {
+	VkDeviceSize size = 0;
+	VkDeviceSize budget = 0;	// VK_EXT_memory_budget 이 없으면 heap size
+	VkDeviceSize usage = 0;		// driver 기준 (다른 process 포함), 없으면 tracked 와 같음
+	VkDeviceSize tracked = 0;	// 이 tracker 를 거친 allocation 합
+	bool deviceLocal = false;
+};
+
+// vkAllocateMemory / vkFreeMemory 를 category 별로 집계 (VulkanUtil::allocateMemory / freeMemory 에서 호출)
+class MemoryTracker {
+public:
+	static std::unique_ptr<MemoryTracker> createMemoryTracker(VkPhysicalDevice physicalDevice, bool budgetSupported);
+	~MemoryTracker();
+
+	void trackAllocation(VkDeviceMemory memory, VkDeviceSize size, uint32_t memoryTypeIndex, MemoryCategory category);
+	void trackFree(VkDeviceMemory memory);
+	void updateBudget();	// heap budget / usage 다시 읽기 (frame 당 한 번 정도)
+
+	bool hasBudget() const { return m_budgetSupported; }
+	VkDeviceSize getCategoryBytes(MemoryCategory category) const { return m_categoryBytes[static_cast<uint32_t>(category)]; }
+	uint32_t getCategoryCount(MemoryCategory category) const { return m_categoryCount[static_cast<uint32_t>(category)]; }
+	VkDeviceSize getTotalBytes() const { return m_totalBytes; }
+	VkDeviceSize getPeakBytes() const { return m_peakBytes; }
+	const std::vector<MemoryHeapStats>& getHeapStats() const { return m_heaps; }
+	void printReport() const;
+
+	static const char* getCategoryName(MemoryCategory category);
+
+private:
+	struct Allocation {
+		VkDeviceSize size;
+		uint32_t heapIndex;
+		MemoryCategory category;
+	};
+
+	VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
+	bool m_budgetSupported = false;
+	std::vector<uint32_t> m_typeToHeap;
+	std::vector<MemoryHeapStats> m_heaps;
+	std::unordered_map<VkDeviceMemory, Allocation> m_allocations;
+	std::array<VkDeviceSize, static_cast<uint32_t>(MemoryCategory::Count)> m_categoryBytes{};
+	std::array<uint32_t, static_cast<uint32_t>(MemoryCategory::Count)> m_categoryCount{};
+	VkDeviceSize m_totalBytes = 0;
+	VkDeviceSize m_peakBytes = 0;
+
+	void init(VkPhysicalDevice physicalDevice, bool budgetSupported);
+	void cleanup();
+};
@@ -16,10 +16,16 @@ public:
 
 	VertexBuffer* getVertexBuffer() { return m_vertexBuffer.get(); }
 	IndexBuffer* getIndexBuffer() { return m_indexBuffer.get(); }
+
+	// emissive triangle 목록을 만들 때 쓰는 CPU 사본
+	const std::vector<Vertex>& getVertices() const { return m_vertices; }
+	const std::vector<uint32_t>& getIndices() const { return m_indices; }
 private:
 	VulkanContext* context;
 	std::unique_ptr<VertexBuffer> m_vertexBuffer;
 	std::unique_ptr<IndexBuffer> m_indexBuffer;
+	std::vector<Vertex> m_vertices;
+	std::vector<uint32_t> m_indices;
 
 	void init(VulkanContext* context, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices, bool hasTangent = false);
 	void cleanup();
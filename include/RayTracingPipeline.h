@@ -7,7 +7,7 @@
 
 class RayTracingPipeline {
 public:
-	static std::unique_ptr<RayTracingPipeline> createPtPipeline(VulkanContext* context, std::vector<DescriptorSetLayout*> descriptorSetLayouts);
+	static std::unique_ptr<RayTracingPipeline> createPtPipeline(VulkanContext* context, std::vector<DescriptorSetLayout*> descriptorSetLayouts, bool enableRayStats = false);
 	~RayTracingPipeline();
 
 	VkPipeline getPipeline() const { return m_pipeline; }
@@ -30,6 +30,6 @@ private:
 	VkStridedDeviceAddressRegionKHR m_hitRegion{};
 
 	void cleanup();
-	void initPt(VulkanContext* context, std::vector<DescriptorSetLayout*> descriptorSetLayouts);
+	void initPt(VulkanContext* context, std::vector<DescriptorSetLayout*> descriptorSetLayouts, bool enableRayStats);
 	VkShaderModule createShaderModule(VulkanContext* context, const std::vector<char>& code);
 };
\ No newline at end of file
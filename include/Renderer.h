@@ -16,6 +16,10 @@
 #include "GuiRenderer.h"
 #include "AccelerationStructure.h"
 #include "RayTracingPipeline.h"
+#include "ImageIO.h"
+#include "CpuProfiler.h"
+#include "CameraPath.h"
+#include "Sampler.h"
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
@@ -24,23 +28,57 @@
 
 class Renderer {
 public:
-	static std::unique_ptr<Renderer> createRenderer(GLFWwindow* window);
+	static std::unique_ptr<Renderer> createRenderer(GLFWwindow* window, const std::string& environmentPath, float environmentIntensity);
+	static std::unique_ptr<Renderer> createHeadlessRenderer(const HeadlessSettings& settings);
 	~Renderer();
 
 	void update(float deltaTime);
 	void render(float deltaTime);
-	bool isBenchmarkRunning() const { return m_guiRenderer->isBenchmarkRunning(); }
+	void playCameraPath(const std::string& path, float fps, const std::string& outputPath);	// 끝나면 창을 닫음
+
+	// headless
+	void renderOffline();
+	void saveImage(const std::string& path);
+	void renderTiled(const std::string& path);	// tile 단위로 trace 해서 끝난 tile 을 바로 파일에 기록
+	bool isTiled() const { return m_tileSize > 0; }
+	void traceSamples(int32_t sampleCount);	// sampleCount 만큼 trace 하고 완료까지 대기
+	void resetAccumulation();
+	std::vector<float> readAccumImage();		// sample 수로 나눈 linear rgba
+	bool isConverged() const;
+	int32_t getCurrentSpp() const { return m_options.currentSpp; }
+	void setCamera(glm::vec3 position, glm::vec3 direction, float fovY);
+	VkExtent2D getExtent() const { return m_extent; }
+	std::string getDeviceName();
+	GpuProfiler* getGpuProfiler() { return m_gpuProfiler.get(); }
+	MemoryTracker* getMemoryTracker() { return m_context->getMemoryTracker(); }
+	const RayStats& getRayStats() const { return m_rayStats; }
+	void setRayStatsEnabled(bool enabled) { m_rayStats.enabled = enabled; }
+	void resetRayStats() { m_rayStats.accumulatedRays = 0; }
+	const AdaptiveStats& getAdaptiveStats() const { return m_adaptiveStats; }
+	bool isBenchmarkRunning() const { return m_guiRenderer && m_guiRenderer->isBenchmarkRunning(); }
+	bool isIdle() const;
 private:
 	GLFWwindow* window;
 	std::unique_ptr<VulkanContext> m_context;
+	std::unique_ptr<GpuProfiler> m_gpuProfiler;
 	std::unique_ptr<SwapChain> m_swapChain;
 	std::unique_ptr<SyncObjects> m_syncObjects;
 
-	VkExtent2D m_extent;
+	VkExtent2D m_extent;			// trace 하는 영역 (sub-rect)
+	VkExtent2D m_allocExtent;		// 실제 할당된 render target 크기 (bucket)
+	VkExtent2D m_requestedExtent;	// gui viewport 가 요청한 크기
+	float m_resizeTimer = 0.0f;
+
+	// offline tile 렌더링 (m_extent 는 현재 tile 크기)
+	uint32_t m_tileSize = 0;		// 0: tile 렌더링 안 함
+	VkExtent2D m_imageExtent = { 0, 0 };	// 전체 출력 이미지 크기
+	glm::uvec2 m_tileOffset = glm::uvec2(0);
 	uint32_t currentFrame = 0;
 
 	CameraGPU m_camera;
 	OptionsGPU m_options;
+	OptionsGPU m_uploadedOptions;	// 마지막으로 UBO 에 올린 값 (maxSpp, lightCount 변경 시에만 업로드)
+	FramePushConstants m_pushConstants;
 
 	// camera
 	bool m_mousePressed = false;
@@ -50,11 +88,21 @@ private:
 	float m_mouseSensitivity = 0.2f;
 	float m_moveSpeed = 3.0f;
 
+	// camera path 재생 (입력 대신 고정 time step 으로 camera 를 움직임)
+	std::unique_ptr<CameraPath> m_cameraPath;
+	float m_cameraPathFps = 60.0f;
+	std::string m_cameraPathOutput;
+	uint32_t m_cameraPathFrame = 0;
+	std::vector<CameraPathFrame> m_cameraPathFrames;
+
 	std::vector<AreaLight> m_areaLights;
 	std::vector<Object> m_objects;
 
 	std::vector<InstanceGPU> m_instanceGPU;
+	std::vector<glm::mat4> m_instanceTransforms;	// TLAS 용 (m_instanceGPU 와 같은 순서)
 	std::vector<AreaLightGPU> m_areaLightGPU;
+	std::vector<EmissiveTriangleGPU> m_emissiveTriangleGPU;
+	std::vector<EnvironmentCellGPU> m_environmentCells;	// environmentDistWidth x environmentDistHeight, 위에서 아래로
 
 	Scene m_scene;
 
@@ -75,11 +123,23 @@ private:
 	std::unique_ptr<DescriptorSetLayout> m_set5Layout;
 
 	// buffers
-	std::unique_ptr<UniformBuffer> m_cameraBuffer;
 	std::unique_ptr<UniformBuffer> m_optionsBuffer;
 	std::unique_ptr<StorageBuffer> m_materialBuffer;
 	std::unique_ptr<StorageBuffer> m_instanceBuffer;
 	std::unique_ptr<StorageBuffer> m_areaLightBuffer;
+	std::unique_ptr<StorageBuffer> m_emissiveTriangleBuffer;
+	std::unique_ptr<StorageBuffer> m_environmentBuffer;
+	std::unique_ptr<StorageBuffer> m_rayStatsBuffer;
+	std::unique_ptr<StorageBuffer> m_sobolBuffer;		// sampler direction number table
+
+	// ray stats
+	RayStats m_rayStats;
+	bool m_pipelineRayStats = false;	// 현재 pipeline 의 RAY_STATS 값
+
+	// adaptive sampling
+	AdaptiveStats m_adaptiveStats;
+	int32_t m_adaptivePendingSamples = -1;	// host 로 복사했지만 아직 읽지 않은 tile 오차의 sample 수
+	uint32_t m_adaptivePendingTiles = 0;
 
 	// acceleration structure
 	std::vector<std::unique_ptr<BottomLevelAS>> m_blas;
@@ -94,25 +154,45 @@ private:
 	std::unique_ptr<DescriptorSet> m_set2DescSet;
 	std::unique_ptr<DescriptorSet> m_set3DescSet;
 	std::unique_ptr<DescriptorSet> m_set4DescSet;
-	std::array<std::unique_ptr<DescriptorSet>, 2> m_set5DescSets;
+	std::unique_ptr<DescriptorSet> m_set5DescSet;
 
 	// command buffer
 	std::unique_ptr<CommandBuffers> m_commandBuffers;
 
 	// texture
 	std::unique_ptr<Texture> m_outputTexture;
-	std::unique_ptr<Texture> m_accum0Texture;
-	std::unique_ptr<Texture> m_accum1Texture;
+	std::unique_ptr<Texture> m_accumTexture;
+	bool m_adaptiveTargets = false;						// moment / tile 오차가 viewport 크기인지 (아니면 1 x 1 dummy)
+	std::unique_ptr<Texture> m_momentTexture;				// luminance^2 누적
+	std::unique_ptr<StorageBuffer> m_tileErrorBuffer;		// tile 별 상대 오차 x ADAPTIVE_TILE_SLOTS (device local)
+	std::unique_ptr<StorageBuffer> m_tileErrorReadback;	// 마지막 sample 이 쓴 slot 의 host 복사본
 
 	// gui renderer
 	std::unique_ptr<GuiRenderer> m_guiRenderer;
 	std::vector<std::unique_ptr<FrameBuffer>> m_imguiFrameBuffers;
 	std::unique_ptr<RenderPass> m_imguiRenderPass;
 
+	HeadlessSettings m_headlessSettings;
+
 	void cleanup();
-	void init(GLFWwindow* window);
+	void init(GLFWwindow* window, const std::string& environmentPath, float environmentIntensity);
+	void initHeadless(const HeadlessSettings& settings);
+	void initPathTracer();
+	void lookAt(glm::vec3 position, glm::vec3 direction);
+	void updateCameraPath(float deltaTime);
+	void printOfflineStats(float seconds, double samples);
 	void recreateSwapChain();
-	void recreateViewport(ImVec2 newExtent);
+	bool isAdaptiveConverged() const;
+	void recordAdaptiveReadback(VkCommandBuffer cmd, int32_t sampleCount);
+	void collectAdaptiveStats();
+	static uint32_t getAdaptiveTileCount(VkExtent2D extent);
+	void updateViewportExtent(float deltaTime);
+	void recreateViewport(VkExtent2D allocExtent);
+	void createViewportTargets();
+	void updateRayStatsPipeline();
+	void createAdaptiveTargets();
+	void collectRayStats(double traceSeconds);
+	static VkExtent2D getViewportBucket(VkExtent2D extent);
 	void transferImageLayout(VkCommandBuffer cmd, Texture* texture, VkImageLayout oldLayout, VkImageLayout newLayout, VkAccessFlags srcAccessMask, VkAccessFlags dstAccessMask, VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage, uint32_t layerCount = 1);
 
 
@@ -142,6 +222,9 @@ private:
 	void createScene();
 
 	void uploadSceneToGPU();
+	void buildLightAliasTable();
+	void appendEmissiveTriangles(InstanceGPU& instance, const glm::mat4& transform);
+	void loadEnvironment(const std::string& path, float intensity);
 
 	// debug
 	void printAllModelInfo();
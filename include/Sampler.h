@@ -0,0 +1,11 @@
+#pragma once
+
+#include "Common.h"
+
+// low-discrepancy sampler 의 CPU 쪽: Owen-scrambled Sobol (Burley 2020) 의 direction number table
+// scramble / 차원 배치는 shaders/sampler.glsl 의 sampleDimension() 에서
+class Sampler {
+public:
+	// [dimension * SOBOL_BITS + bit], 각 값은 32 bit 고정 소수 (MSB 가 첫 자리)
+	static std::vector<uint32_t> buildSobolDirections();
+};
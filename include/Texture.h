@@ -22,6 +22,7 @@ public:
 		uint32_t height, VkFormat format, VkImageUsageFlags usage, VkImageAspectFlags aspectFlags);
 	static std::unique_ptr<Texture> createTextureFromMemory(VulkanContext* context, const aiTexture* aiTexture, TextureFormatType formatType);
 	static std::unique_ptr<Texture> createTextureFromMemory(VulkanContext* context, const tinygltf::Image& image, TextureFormatType formatType);
+	static std::unique_ptr<Texture> createHDRTextureFromMemory(VulkanContext* context, const std::vector<float>& rgba, uint32_t width, uint32_t height);
 
 	~Texture();
 
@@ -47,6 +48,7 @@ private:
 		uint32_t height, VkFormat format, VkImageUsageFlags usage, VkImageAspectFlags aspectFlags);
 	void initTextureFromMemory(VulkanContext* context, const aiTexture* aiTexture, TextureFormatType formatType);
 	void initTextureFromMemory(VulkanContext* context, const tinygltf::Image& image, TextureFormatType formatType);
+	void initHDRTextureFromMemory(VulkanContext* context, const std::vector<float>& rgba, uint32_t width, uint32_t height);
 
 	void cleanup();
 
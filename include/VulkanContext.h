@@ -2,9 +2,13 @@
 
 #include "Common.h"
 
+class GpuProfiler;
+class MemoryTracker;
+
 class VulkanContext {
 public:
 	static std::unique_ptr<VulkanContext> createVulkanContext(GLFWwindow* window);
+	static std::unique_ptr<VulkanContext> createHeadlessVulkanContext();
 	~VulkanContext();
 	void createSurface(GLFWwindow* window);
 
@@ -18,14 +22,22 @@ public:
 	VkSurfaceKHR getSurface() { return m_surface; }
 	VkSampleCountFlagBits getMaxMsaaSamples() { return m_maxMsaaSamples; }
 	VkDescriptorPool getDescriptorPool() { return m_descriptorPool; }
+	VkPipelineCache getPipelineCache() { return m_pipelineCache; }
+	bool isPipelineCacheWarm() { return m_pipelineCacheWarm; }
 	uint32_t getQueueFamily() { return findQueueFamilies(m_physicalDevice).graphicsFamily.value(); }
+	bool isHeadless() { return m_headless; }
+	GpuProfiler* getGpuProfiler() { return m_gpuProfiler; }
+	void setGpuProfiler(GpuProfiler* profiler) { m_gpuProfiler = profiler; }
+	MemoryTracker* getMemoryTracker() { return m_memoryTracker.get(); }
 
 private:
 	VulkanContext() {}
 
 	VkInstance m_instance;
 	VkDebugUtilsMessengerEXT m_debugMessenger;
-	VkSurfaceKHR m_surface;
+	VkSurfaceKHR m_surface = VK_NULL_HANDLE;
+	bool m_headless = false;
+	bool m_debugUtils = false;		// VK_EXT_debug_utils (validation 이 꺼져 있어도 label 용으로 켬)
 	VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
 	VkSampleCountFlagBits m_maxMsaaSamples = VK_SAMPLE_COUNT_1_BIT;
 	VkDevice m_device;
@@ -33,6 +45,11 @@ private:
 	VkQueue m_presentQueue;
 	VkCommandPool m_commandPool;
 	VkDescriptorPool m_descriptorPool;
+	VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;
+	bool m_pipelineCacheWarm = false;
+	GpuProfiler* m_gpuProfiler = nullptr;	// Renderer 소유, single time command 에서도 zone 기록
+	bool m_memoryBudget = false;			// VK_EXT_memory_budget
+	std::unique_ptr<MemoryTracker> m_memoryTracker;
 
 
 	void init(GLFWwindow* window);
@@ -47,11 +64,17 @@ private:
 	VkSampleCountFlagBits getMaxUsableSampleCount();
 	QueueFamilyIndices findQueueFamilies(VkPhysicalDevice device);
 	bool checkDeviceExtensionSupport(VkPhysicalDevice device);
+	bool checkOptionalDeviceExtensionSupport(VkPhysicalDevice device, const char* extensionName);
+	std::vector<const char*> getDeviceExtensions();
 	SwapChainSupportDetails querySwapChainSupport(VkPhysicalDevice device);
 	void createLogicalDevice();
 	void createCommandPool();
 	void createDescriptorPool();
+	void createPipelineCache();
+	void savePipelineCache();
 	void loadRayTracingFunctions();
+	void loadDebugUtilsFunctions();
+	bool checkInstanceExtensionSupport(const char* extensionName);
 
 
 	static VKAPI_ATTR VkBool32 VKAPI_CALL debugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
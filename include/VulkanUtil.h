@@ -2,19 +2,27 @@
 
 #include "Common.h"
 #include "VulkanContext.h"
+#include "GpuProfiler.h"
+#include "MemoryTracker.h"
 
 class VulkanUtil {
 public:
-	static void createImage(VulkanContext* context, uint32_t width, uint32_t height, uint32_t mipLevels, VkSampleCountFlagBits numSamples, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory, bool isCubeMap = false);
+	static void createImage(VulkanContext* context, uint32_t width, uint32_t height, uint32_t mipLevels, VkSampleCountFlagBits numSamples, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory, bool isCubeMap = false, MemoryCategory category = MemoryCategory::Auto);
 	static uint32_t findMemoryType(VulkanContext* context, uint32_t typeFilter, VkMemoryPropertyFlags properties);
 	static VkImageView createImageView(VulkanContext* context, VkImage image, VkFormat format, VkImageAspectFlags aspectFlags, uint32_t mipLevels, bool isCubeMap = false);
 	static VkCommandBuffer beginSingleTimeCommands(VulkanContext* context);
 	static void endSingleTimeCommands(VulkanContext* context, VkCommandBuffer commandBuffer);
 	
-	static void createBuffer(VulkanContext* context, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory);
+	static void createBuffer(VulkanContext* context, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory, MemoryCategory category = MemoryCategory::Auto);
 	static void copyBuffer(VulkanContext* context, VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size);
 	static VkDeviceAddress getDeviceAddress(VulkanContext* context, VkBuffer buffer);
 
+	// 모든 device memory 는 여기를 거쳐서 MemoryTracker 에 기록
+	static VkResult allocateMemory(VulkanContext* context, const VkMemoryAllocateInfo& allocInfo, VkDeviceMemory& memory, MemoryCategory category);
+	static void freeMemory(VulkanContext* context, VkDeviceMemory memory);
+	static MemoryCategory getBufferCategory(VkBufferUsageFlags usage, MemoryCategory category);
+	static MemoryCategory getImageCategory(VkImageUsageFlags usage, MemoryCategory category);
+
 
 	static VkFormat findDepthFormat(VulkanContext* context);
 	static VkFormat findSupportedFormat(VulkanContext* context, const std::vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features);
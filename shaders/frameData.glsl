@@ -0,0 +1,47 @@
+#ifndef FRAME_DATA_GLSL
+#define FRAME_DATA_GLSL
+
+// 모든 ray tracing stage 가 공유하는 frame 단위 입력 (Common.h 의 FramePushConstants / OptionsGPU / RayStatsGPU 와 같아야 함)
+
+layout(push_constant) uniform FramePushConstants {
+    vec3 camPos;
+    int frameCount;
+    vec3 camDir;
+    int currentSpp;
+    vec3 camUp;
+    float pad0;
+    vec3 camRight;
+    float fovY;
+    uvec2 tileOffset;   // launch id + tileOffset = 전체 이미지의 pixel
+    uvec2 imageSize;    // 전체 이미지 크기 (tile 이 아니면 trace 크기와 같음)
+} pc;
+
+// frameCount, currentSpp 는 push constant 사용
+layout(set = 0, binding = 0) uniform OptionsGPU {
+    int pad0;
+    int maxSpp;
+    int pad1;
+    int lightCount;
+    int adaptive;
+    float adaptiveError;
+    int adaptiveMinSpp;
+    int emissiveTriangleCount;
+    float areaLightSelectProb;  // NEE 에서 quad light 집합을 고를 확률 (나머지는 emissive triangle)
+    int environmentTexIndex;    // < 0 이면 environment 없음
+    float environmentIntensity;
+    int environmentDistWidth;
+    int environmentDistHeight;
+    float environmentSelectProb; // NEE 에서 environment 를 고를 확률 (quad / triangle 은 나머지 안에서)
+} options;
+
+// ray / path 통계 (RAY_STATS == false 면 compile 시 제거)
+layout(constant_id = 0) const bool RAY_STATS = false;
+layout(set = 0, binding = 1) buffer RayStatsBuffer {
+    uint pathLengths[16];
+    uint shadowRays;
+    uint rouletteKills;
+    uint missTerminations;
+    uint lightHits;
+} rayStats;
+
+#endif
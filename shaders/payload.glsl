@@ -0,0 +1,19 @@
+#ifndef PAYLOAD_GLSL
+#define PAYLOAD_GLSL
+
+// raygen 과 closest hit / miss 가 주고받는 path 상태 (location 0)
+struct RayPayload {
+    vec3 L;
+    vec3 beta;
+    vec3 nextOrigin;
+    vec3 nextDir;
+    uint seed;
+    float pdf;
+    uint state;     // bit 0-7: bounce, 31: terminated
+    uint cone;      // ray cone (texture LOD): packHalf2x16(origin 에서의 폭, 퍼짐 각 radian)
+};
+
+const uint PAYLOAD_BOUNCE_MASK = 0xffu;
+const uint PAYLOAD_TERMINATED = 0x80000000u;
+
+#endif
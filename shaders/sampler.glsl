@@ -0,0 +1,69 @@
+#ifndef SAMPLER_GLSL
+#define SAMPLER_GLSL
+
+// low-discrepancy sampler: Owen-scrambled Sobol (Burley 2020, hash 기반 nested uniform scramble)
+// 차원은 SOBOL_DIMENSIONS 개씩 묶고 (padding) 묶음마다 sample index 를 따로 섞음
+const uint SOBOL_DIMENSIONS = 4;
+const uint SOBOL_BITS = 32;
+layout(set = 0, binding = 2) readonly buffer SobolBuffer {
+    uint sobolDirections[];    // [dimension * SOBOL_BITS + bit] (Sampler::buildSobolDirections)
+};
+
+// 차원 배치: camera 4 개, 이후 bounce 마다 SAMPLER_DIMS_PER_BOUNCE 개
+const uint SAMPLER_DIMS_CAMERA = 4;
+const uint SAMPLER_DIMS_PER_BOUNCE = 12;
+const uint SAMPLER_CAMERA_JITTER = 0;      // x, y
+const uint SAMPLER_LIGHT_SET = 0;          // + bounce offset
+const uint SAMPLER_LIGHT_SLOT = 1;
+const uint SAMPLER_LIGHT_U = 2;
+const uint SAMPLER_LIGHT_V = 3;
+const uint SAMPLER_BSDF_LOBE = 4;
+const uint SAMPLER_BSDF_U = 5;
+const uint SAMPLER_BSDF_V = 6;
+const uint SAMPLER_BSDF_TRANSMISSION = 7;
+const uint SAMPLER_ROULETTE = 8;
+const uint SAMPLER_LIGHT_ENVIRONMENT = 9;  // NEE 에서 environment 를 고를지
+
+uint hashUint(uint x) {
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+uint hashCombine(uint seed, uint value) {
+    return seed ^ (hashUint(value) + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+}
+
+uint nestedUniformScramble(uint x, uint seed) {
+    x = bitfieldReverse(x);
+    x += seed;
+    x ^= x * 0x6c50b47cu;
+    x ^= x * 0xb82f1e52u;
+    x ^= x * 0xc7afe638u;
+    x ^= x * 0x8d22f6e6u;
+    return bitfieldReverse(x);
+}
+
+uint sobol(uint index, uint dimension) {
+    uint x = 0;
+    for (uint bit = 0; index != 0; bit++, index >>= 1) {
+        if ((index & 1u) != 0) {
+            x ^= sobolDirections[dimension * SOBOL_BITS + bit];
+        }
+    }
+    return x;
+}
+
+// pixelSeed: pixel 마다 고정 (payload.seed), sampleIndex: pc.currentSpp
+float sampleDimension(uint pixelSeed, uint sampleIndex, uint dimension) {
+    uint groupSeed = hashCombine(pixelSeed, dimension / SOBOL_DIMENSIONS);
+    uint index = nestedUniformScramble(sampleIndex, groupSeed);
+    uint component = dimension % SOBOL_DIMENSIONS;
+    uint x = nestedUniformScramble(sobol(index, component), hashCombine(groupSeed, component + 1));
+    return float(x >> 8) * (1.0 / 16777216.0);    // [0, 1)
+}
+
+#endif
@@ -18,7 +18,7 @@ void AccelerationStructure::cleanup() {
 	}
 
 	if (m_memory != VK_NULL_HANDLE) {
-		vkFreeMemory(context->getDevice(), m_memory, nullptr);
+		VulkanUtil::freeMemory(context, m_memory);
 		m_memory = VK_NULL_HANDLE;
 	}
 
@@ -95,7 +95,7 @@ void BottomLevelAS::initBLAS(VulkanContext* context, Mesh* mesh) {
 	VulkanUtil::createBuffer(context, sizeInfo.buildScratchSize,
 		VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
 		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-		scratchBuffer, scratchMemory);
+		scratchBuffer, scratchMemory, MemoryCategory::Scratch);
 
 	VkBufferDeviceAddressInfo scratchAddrInfo{};
 	scratchAddrInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
@@ -113,7 +113,10 @@ void BottomLevelAS::initBLAS(VulkanContext* context, Mesh* mesh) {
 	std::array<VkAccelerationStructureBuildRangeInfoKHR*, 1> rangeInfos = { &rangeInfo };
 
 	auto cmd = VulkanUtil::beginSingleTimeCommands(context);
-	g_vkCmdBuildAccelerationStructuresKHR(cmd, 1, &buildInfo, rangeInfos.data());
+	{
+		GpuProfiler::Scope zone(context->getGpuProfiler(), cmd, "blas build");
+		g_vkCmdBuildAccelerationStructuresKHR(cmd, 1, &buildInfo, rangeInfos.data());
+	}
 	VulkanUtil::endSingleTimeCommands(context, cmd);
 
 	VkAccelerationStructureDeviceAddressInfoKHR addrInfo{};
@@ -122,25 +125,25 @@ void BottomLevelAS::initBLAS(VulkanContext* context, Mesh* mesh) {
 	m_deviceAddress = g_vkGetAccelerationStructureDeviceAddressKHR(context->getDevice(), &addrInfo);
 
 	vkDestroyBuffer(context->getDevice(), scratchBuffer, nullptr);
-	vkFreeMemory(context->getDevice(), scratchMemory, nullptr);
+	VulkanUtil::freeMemory(context, scratchMemory);
 }
 
 std::unique_ptr<TopLevelAS> TopLevelAS::createTopLevelAS(VulkanContext* context, std::vector<std::unique_ptr<BottomLevelAS>>& blasList,
-	std::vector<InstanceGPU>& instanceList) {
+	std::vector<InstanceGPU>& instanceList, std::vector<glm::mat4>& transformList) {
 	std::unique_ptr<TopLevelAS> as = std::unique_ptr<TopLevelAS>(new TopLevelAS());
-	as->initTLAS(context, blasList, instanceList);
+	as->initTLAS(context, blasList, instanceList, transformList);
 	return as;
 }
 
 void TopLevelAS::initTLAS(VulkanContext* context, std::vector<std::unique_ptr<BottomLevelAS>>& blasList,
-	std::vector<InstanceGPU>& instanceList) {
+	std::vector<InstanceGPU>& instanceList, std::vector<glm::mat4>& transformList) {
 	this->context = context;
 
 	std::vector<VkAccelerationStructureInstanceKHR> instances;
 
 	for (int i = 0; i < instanceList.size(); i++) {
 		VkAccelerationStructureInstanceKHR tlasInstance{};
-		tlasInstance.transform = glmToVkTransform(instanceList[i].transform);
+		tlasInstance.transform = glmToVkTransform(transformList[i]);
 		tlasInstance.instanceCustomIndex = i;
 		tlasInstance.mask = 0xFF;
 		tlasInstance.instanceShaderBindingTableRecordOffset = 0;
@@ -161,7 +164,8 @@ void TopLevelAS::initTLAS(VulkanContext* context, std::vector<std::unique_ptr<Bo
 		VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR,
 		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
 		instanceBuffer,
-		instanceMemory
+		instanceMemory,
+		MemoryCategory::Scratch		// build 입력, build 후 바로 해제
 	);
 
 	void* data;
@@ -224,7 +228,7 @@ void TopLevelAS::initTLAS(VulkanContext* context, std::vector<std::unique_ptr<Bo
 		sizeInfo.buildScratchSize,
 		VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
 		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-		scratchBuffer, scratchMemory);
+		scratchBuffer, scratchMemory, MemoryCategory::Scratch);
 
 	VkDeviceAddress scratchAddress = VulkanUtil::getDeviceAddress(context, scratchBuffer);
 	buildInfo.scratchData.deviceAddress = scratchAddress;
@@ -238,7 +242,10 @@ void TopLevelAS::initTLAS(VulkanContext* context, std::vector<std::unique_ptr<Bo
 	const VkAccelerationStructureBuildRangeInfoKHR* rangeInfos[] = { &rangeInfo };
 
 	VkCommandBuffer cmd = VulkanUtil::beginSingleTimeCommands(context);
-	g_vkCmdBuildAccelerationStructuresKHR(cmd, 1, &buildInfo, rangeInfos);
+	{
+		GpuProfiler::Scope zone(context->getGpuProfiler(), cmd, "tlas build");
+		g_vkCmdBuildAccelerationStructuresKHR(cmd, 1, &buildInfo, rangeInfos);
+	}
 	VulkanUtil::endSingleTimeCommands(context, cmd);
 
 	VkAccelerationStructureDeviceAddressInfoKHR addrInfo{};
@@ -247,16 +254,16 @@ void TopLevelAS::initTLAS(VulkanContext* context, std::vector<std::unique_ptr<Bo
 	m_deviceAddress = g_vkGetAccelerationStructureDeviceAddressKHR(context->getDevice(), &addrInfo);
 
 	vkDestroyBuffer(context->getDevice(), scratchBuffer, nullptr);
-	vkFreeMemory(context->getDevice(), scratchMemory, nullptr);
+	VulkanUtil::freeMemory(context, scratchMemory);
 	vkDestroyBuffer(context->getDevice(), instanceBuffer, nullptr);
-	vkFreeMemory(context->getDevice(), instanceMemory, nullptr);
+	VulkanUtil::freeMemory(context, instanceMemory);
 }
 
 void TopLevelAS::recreate(std::vector<std::unique_ptr<BottomLevelAS>>& blasList,
-	std::vector<InstanceGPU>& instanceList) {
+	std::vector<InstanceGPU>& instanceList, std::vector<glm::mat4>& transformList) {
 
 	cleanup();
-	initTLAS(context, blasList, instanceList);
+	initTLAS(context, blasList, instanceList, transformList);
 }
 
 // std::unique_ptr<TopLevelAS> TopLevelAS::createEmptyTopLevelAS(VulkanContext* context) {
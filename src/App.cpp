@@ -1,6 +1,6 @@
 #include "include/App.h"
 
-App::App() {
+App::App(const HeadlessSettings& settings) : m_settings(settings) {
 	init();
 }
 
@@ -13,21 +13,40 @@ void App::run() {
 	auto lastTime = std::chrono::high_resolution_clock::now();
 
 	while (!glfwWindowShouldClose(m_window->getWindow())) {
+		CpuProfiler::Scope frameZone("frame");
 
 		auto currentTime = std::chrono::high_resolution_clock::now();
 		float deltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
 		lastTime = currentTime;
 
-		glfwPollEvents();
-		m_renderer->update(deltaTime);
+		// 수렴 후에는 입력 이벤트가 있을 때만 다시 그린다
+		{
+			CpuProfiler::Scope zone("events");
+			if (m_renderer->isIdle()) {
+				glfwWaitEventsTimeout(IDLE_WAIT_TIMEOUT);
+			}
+			else {
+				glfwPollEvents();
+			}
+		}
+		{
+			CpuProfiler::Scope zone("update");
+			m_renderer->update(deltaTime);
+		}
 		m_renderer->render(deltaTime);
 	}
 }
 
 void App::init() {
 	std::cout << "App::init" << std::endl;
-	m_window = Window::createWindow();
-	m_renderer = Renderer::createRenderer(m_window->getWindow());
+	{
+		CpuProfiler::Scope zone("Window");
+		m_window = Window::createWindow();
+	}
+	m_renderer = Renderer::createRenderer(m_window->getWindow(), m_settings.environmentPath, m_settings.environmentIntensity);
+	if (!m_settings.cameraPath.empty()) {
+		m_renderer->playCameraPath(m_settings.cameraPath, m_settings.cameraPathFps, m_settings.cameraPathOutput);
+	}
 }
 
 void App::cleanup()
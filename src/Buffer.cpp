@@ -3,7 +3,7 @@
 #include "stb_image.h"
 
 void Buffer::createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer &buffer,
-					  VkDeviceMemory &bufferMemory) {
+					  VkDeviceMemory &bufferMemory, MemoryCategory category) {
 	VkBufferCreateInfo bufferInfo{};
 	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
 	bufferInfo.size = size;
@@ -27,7 +27,7 @@ void Buffer::createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryP
 	allocInfo.memoryTypeIndex = VulkanUtil::findMemoryType(context, memRequirements.memoryTypeBits, properties);
 	allocInfo.pNext = &allocFlagsInfo;
 
-	if (vkAllocateMemory(context->getDevice(), &allocInfo, nullptr, &bufferMemory) != VK_SUCCESS)
+	if (VulkanUtil::allocateMemory(context, allocInfo, bufferMemory, VulkanUtil::getBufferCategory(usage, category)) != VK_SUCCESS)
 	{
 		throw std::runtime_error("failed to allocate buffer memory!");
 	}
@@ -40,7 +40,10 @@ void Buffer::copyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize siz
 
 	VkBufferCopy copyRegion{};
 	copyRegion.size = size;
-	vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
+	{
+		GpuProfiler::Scope zone(context->getGpuProfiler(), commandBuffer, "upload");
+		vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
+	}
 
 	VulkanUtil::endSingleTimeCommands(context, commandBuffer);	
 }
@@ -82,7 +85,7 @@ void VertexBuffer::init(VulkanContext* context, std::vector<Vertex> &vertices) {
 	copyBuffer(stagingBuffer, m_buffer, bufferSize);
 
 	vkDestroyBuffer(context->getDevice(), stagingBuffer, nullptr);
-	vkFreeMemory(context->getDevice(), stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(context, stagingBufferMemory);
 }
 
 void VertexBuffer::bind(VkCommandBuffer commandBuffer) {
@@ -97,7 +100,7 @@ VertexBuffer::~VertexBuffer() {
 
 void VertexBuffer::cleanup() {
 	vkDestroyBuffer(context->getDevice(), m_buffer, nullptr);
-	vkFreeMemory(context->getDevice(), m_bufferMemory, nullptr);
+	VulkanUtil::freeMemory(context, m_bufferMemory);
 }
 
 
@@ -127,7 +130,7 @@ void IndexBuffer::init(VulkanContext* context, std::vector<uint32_t>& indices) {
 	copyBuffer(stagingBuffer, m_buffer, bufferSize);
 
 	vkDestroyBuffer(context->getDevice(), stagingBuffer, nullptr);
-	vkFreeMemory(context->getDevice(), stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(context, stagingBufferMemory);
 }
 
 IndexBuffer::~IndexBuffer() {
@@ -136,7 +139,7 @@ IndexBuffer::~IndexBuffer() {
 
 void IndexBuffer::cleanup() {
 	vkDestroyBuffer(context->getDevice(), m_buffer, nullptr);
-	vkFreeMemory(context->getDevice(), m_bufferMemory, nullptr);
+	VulkanUtil::freeMemory(context, m_bufferMemory);
 }
 
 
@@ -180,7 +183,7 @@ bool ImageBuffer::init(VulkanContext* context, std::string path, VkFormat format
 	copyBufferToImage(stagingBuffer, m_image, static_cast<uint32_t>(texWidth), static_cast<uint32_t>(texHeight));
 
 	vkDestroyBuffer(context->getDevice(), stagingBuffer, nullptr);
-	vkFreeMemory(context->getDevice(), stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(context, stagingBufferMemory);
 
 	generateMipmaps(m_image, format, texWidth, texHeight, m_mipLevels);
 	return true;
@@ -265,7 +268,10 @@ void ImageBuffer::copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t wid
 	};
 
 	// Ŀ�ǵ� ���ۿ� ���� -> �̹����� ������ �����ϴ� ���� ���
-	vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+	{
+		GpuProfiler::Scope zone(context->getGpuProfiler(), commandBuffer, "upload");
+		vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+	}
 
 	// Ŀ�ǵ� ���� ��� ���� �� ����
 	VulkanUtil::endSingleTimeCommands(context, commandBuffer);
@@ -374,7 +380,7 @@ ImageBuffer::~ImageBuffer() {
 void ImageBuffer::cleanup() {
 	// std::cout << "ImageBuffer::cleanup" << std::endl;
 	vkDestroyImage(context->getDevice(), m_image, nullptr);
-	vkFreeMemory(context->getDevice(), m_textureImageMemory, nullptr);
+	VulkanUtil::freeMemory(context, m_textureImageMemory);
 }
 
 std::unique_ptr<ImageBuffer> ImageBuffer::createHDRImageBuffer(VulkanContext* context, std::string path)
@@ -386,13 +392,29 @@ std::unique_ptr<ImageBuffer> ImageBuffer::createHDRImageBuffer(VulkanContext* co
 }
 
 bool ImageBuffer::initHDR(VulkanContext* context, std::string path) {
-	this->context = context;
-
 	int texWidth, texHeight, texChannels;
 	float* pixels = stbi_loadf(path.c_str(), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
 	if (!pixels)
 		return false;
-	VkDeviceSize imageSize = texWidth * texHeight * 4 * sizeof(float);
+	initHDRFromMemory(context, pixels, static_cast<uint32_t>(texWidth), static_cast<uint32_t>(texHeight));
+	stbi_image_free(pixels);
+	return true;
+}
+
+std::unique_ptr<ImageBuffer> ImageBuffer::createHDRImageBufferFromMemory(VulkanContext* context, const float* rgba, uint32_t width, uint32_t height)
+{
+	std::unique_ptr<ImageBuffer> imageBuffer = std::unique_ptr<ImageBuffer>(new ImageBuffer());
+	imageBuffer->initHDRFromMemory(context, rgba, width, height);
+	return imageBuffer;
+}
+
+// rgba: linear float, width * height * 4, top-down
+void ImageBuffer::initHDRFromMemory(VulkanContext* context, const float* rgba, uint32_t width, uint32_t height) {
+	this->context = context;
+
+	int32_t texWidth = static_cast<int32_t>(width);
+	int32_t texHeight = static_cast<int32_t>(height);
+	VkDeviceSize imageSize = static_cast<VkDeviceSize>(width) * height * 4 * sizeof(float);
 
 	m_mipLevels = static_cast<uint32_t>(std::floor(std::log2(std::max(texWidth, texHeight)))) + 1;
 
@@ -404,10 +426,9 @@ bool ImageBuffer::initHDR(VulkanContext* context, std::string path) {
 
 	void* data;
 	vkMapMemory(context->getDevice(), stagingBufferMemory, 0, imageSize, 0, &data);
-	memcpy(data, pixels, static_cast<size_t>(imageSize));
+	memcpy(data, rgba, static_cast<size_t>(imageSize));
 	vkUnmapMemory(context->getDevice(), stagingBufferMemory);
 
-	stbi_image_free(pixels);
 	VulkanUtil::createImage(context,
 		texWidth, texHeight, m_mipLevels, VK_SAMPLE_COUNT_1_BIT, VK_FORMAT_R32G32B32A32_SFLOAT, VK_IMAGE_TILING_OPTIMAL,
 		VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
@@ -418,10 +439,9 @@ bool ImageBuffer::initHDR(VulkanContext* context, std::string path) {
 	copyBufferToImage(stagingBuffer, m_image, static_cast<uint32_t>(texWidth), static_cast<uint32_t>(texHeight));
 
 	vkDestroyBuffer(context->getDevice(), stagingBuffer, nullptr);
-	vkFreeMemory(context->getDevice(), stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(context, stagingBufferMemory);
 
 	generateMipmaps(m_image, VK_FORMAT_R32G32B32A32_SFLOAT, texWidth, texHeight, m_mipLevels);
-	return true;
 }
 
 std::unique_ptr<ImageBuffer> ImageBuffer::createDefaultImageBuffer(VulkanContext* context, glm::vec4 color)
@@ -468,7 +488,7 @@ void ImageBuffer::initDefault(VulkanContext* context, glm::vec4 color)
 		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, m_mipLevels);
 
 	vkDestroyBuffer(context->getDevice(), stagingBuffer, nullptr);
-	vkFreeMemory(context->getDevice(), stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(context, stagingBufferMemory);
 }
 
 std::unique_ptr<ImageBuffer> ImageBuffer::createAttachmentImageBuffer(VulkanContext* context, uint32_t width,
@@ -567,7 +587,7 @@ bool ImageBuffer::initFromMemory(VulkanContext* context, const aiTexture* textur
 	copyBufferToImage(stagingBuffer, m_image, static_cast<uint32_t>(texWidth), static_cast<uint32_t>(texHeight));
 
 	vkDestroyBuffer(context->getDevice(), stagingBuffer, nullptr);
-	vkFreeMemory(context->getDevice(), stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(context, stagingBufferMemory);
 
 	generateMipmaps(m_image, format, texWidth, texHeight, m_mipLevels);
 }
@@ -615,7 +635,7 @@ bool ImageBuffer::initFromMemory(VulkanContext* context, const tinygltf::Image&
 	copyBufferToImage(stagingBuffer, m_image, static_cast<uint32_t>(texWidth), static_cast<uint32_t>(texHeight));
 
 	vkDestroyBuffer(context->getDevice(), stagingBuffer, nullptr);
-	vkFreeMemory(context->getDevice(), stagingBufferMemory, nullptr);
+	VulkanUtil::freeMemory(context, stagingBufferMemory);
 
 	generateMipmaps(m_image, format, texWidth, texHeight, m_mipLevels);
 
@@ -657,7 +677,7 @@ void UniformBuffer::cleanup() {
 	}
 	if (m_bufferMemory != VK_NULL_HANDLE)
 	{
-		vkFreeMemory(context->getDevice(), m_bufferMemory, nullptr);
+		VulkanUtil::freeMemory(context, m_bufferMemory);
 		m_bufferMemory = VK_NULL_HANDLE;
 	}
 }
@@ -672,14 +692,25 @@ std::unique_ptr<StorageBuffer> StorageBuffer::createStorageBuffer(VulkanContext*
 	return storageBuffer;
 }
 
-void StorageBuffer::init(VulkanContext* context, VkDeviceSize buffersize, size_t count) {
+std::unique_ptr<StorageBuffer> StorageBuffer::createDeviceLocalStorageBuffer(VulkanContext* context, VkDeviceSize buffersize, size_t count) {
+	std::unique_ptr<StorageBuffer> storageBuffer = std::unique_ptr<StorageBuffer>(new StorageBuffer());
+	storageBuffer->init(context, buffersize, count, true);
+	return storageBuffer;
+}
+
+void StorageBuffer::init(VulkanContext* context, VkDeviceSize buffersize, size_t count, bool deviceLocal) {
 	this->context = context;
 
 	if (count == 0)
 		count = 1;
 	m_currentSize = buffersize * count;
 	std::cout << "StorageBuffer::size == " << m_currentSize << std::endl;
-	createBuffer(m_currentSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+	VkBufferUsageFlags usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+	if (deviceLocal) {
+		createBuffer(m_currentSize, usage, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, m_buffer, m_bufferMemory);
+		return;
+	}
+	createBuffer(m_currentSize, usage,
 		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, m_buffer, m_bufferMemory);
 	vkMapMemory(context->getDevice(), m_bufferMemory, 0, m_currentSize, 0, &m_mappedMemory);
 }
@@ -702,7 +733,7 @@ void StorageBuffer::cleanup() {
 	}
 	if (m_bufferMemory != VK_NULL_HANDLE)
 	{
-		vkFreeMemory(context->getDevice(), m_bufferMemory, nullptr);
+		VulkanUtil::freeMemory(context, m_bufferMemory);
 		m_bufferMemory = VK_NULL_HANDLE;
 	}
 	m_currentSize = 0;
@@ -748,7 +779,8 @@ void StorageBuffer::resizeStorageBuffer(VkDeviceSize size, size_t count)
 {
 	if (size * count > m_currentSize)
 	{
+		bool deviceLocal = m_mappedMemory == nullptr;
 		cleanup();
-		init(context, size, count);
+		init(context, size, count, deviceLocal);
 	}
 }
\ No newline at end of file
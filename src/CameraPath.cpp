@@ -0,0 +1,102 @@
+#include "include/CameraPath.h"
+#include <sstream>
+
+std::unique_ptr<CameraPath> CameraPath::createCameraPath(const std::string& path) {
+	std::unique_ptr<CameraPath> cameraPath = std::unique_ptr<CameraPath>(new CameraPath());
+	cameraPath->init(path);
+	return cameraPath;
+}
+
+void CameraPath::init(const std::string& path) {
+	std::ifstream file(path);
+	if (!file.is_open()) {
+		throw std::runtime_error("failed to open file: " + path);
+	}
+
+	std::string line;
+	uint32_t lineNumber = 0;
+	while (std::getline(file, line)) {
+		lineNumber++;
+		line = line.substr(0, line.find('#'));
+		if (line.find_first_not_of(" \t\r") == std::string::npos) {
+			continue;
+		}
+
+		CameraKeyframe key;
+		std::istringstream stream(line);
+		if (!(stream >> key.time >> key.position.x >> key.position.y >> key.position.z >> key.yaw >> key.pitch >> key.fovY)) {
+			throw std::runtime_error(path + ":" + std::to_string(lineNumber) + ": expected time x y z yaw pitch fov");
+		}
+		if (!m_keyframes.empty() && key.time <= m_keyframes.back().time) {
+			throw std::runtime_error(path + ":" + std::to_string(lineNumber) + ": keyframe times must increase");
+		}
+		key.pitch = std::clamp(key.pitch, -89.0f, 89.0f);
+		m_keyframes.push_back(key);
+	}
+
+	if (m_keyframes.empty()) {
+		throw std::runtime_error("camera path has no keyframes: " + path);
+	}
+	std::cout << "CameraPath::init - " << path << ", " << m_keyframes.size() << " keyframes, " << getDuration() << " s" << std::endl;
+}
+
+CameraKeyframe CameraPath::evaluate(float time) const {
+	if (time <= m_keyframes.front().time || time >= m_keyframes.back().time) {
+		CameraKeyframe key = time <= m_keyframes.front().time ? m_keyframes.front() : m_keyframes.back();
+		key.time = time;
+		return key;
+	}
+
+	auto next = std::upper_bound(m_keyframes.begin(), m_keyframes.end(), time,
+		[](float t, const CameraKeyframe& key) { return t < key.time; });
+	const CameraKeyframe& b = *next;
+	const CameraKeyframe& a = *(next - 1);
+	float t = (time - a.time) / (b.time - a.time);
+
+	CameraKeyframe key;
+	key.time = time;
+	key.position = glm::mix(a.position, b.position, t);
+	key.yaw = glm::mix(a.yaw, b.yaw, t);
+	key.pitch = glm::mix(a.pitch, b.pitch, t);
+	key.fovY = glm::mix(a.fovY, b.fovY, t);
+	return key;
+}
+
+uint32_t CameraPath::getFrameCount(float fps) const {
+	return static_cast<uint32_t>(std::floor(getDuration() * fps)) + 1;
+}
+
+glm::vec3 CameraPath::getDirection(float yaw, float pitch) {
+	glm::vec3 direction;
+	direction.x = cos(glm::radians(yaw)) * cos(glm::radians(pitch));
+	direction.y = sin(glm::radians(pitch));
+	direction.z = sin(glm::radians(yaw)) * cos(glm::radians(pitch));
+	return glm::normalize(direction);
+}
+
+void CameraPath::writeFrameTimings(const std::string& path, const std::vector<CameraPathFrame>& frames) {
+	std::ofstream file(path);
+	if (!file.is_open()) {
+		throw std::runtime_error("failed to open file: " + path);
+	}
+
+	file << std::fixed << std::setprecision(4);
+	file << "frame,time,frameMs,gpuMs,spp\n";
+	for (const CameraPathFrame& frame : frames) {
+		file << frame.frame << "," << frame.time << "," << frame.frameMs << "," << frame.gpuMs << "," << frame.spp << "\n";
+	}
+
+	if (frames.empty()) {
+		return;
+	}
+	std::vector<double> sorted;
+	double totalMs = 0.0;
+	for (const CameraPathFrame& frame : frames) {
+		sorted.push_back(frame.frameMs);
+		totalMs += frame.frameMs;
+	}
+	std::sort(sorted.begin(), sorted.end());
+	std::cout << "CameraPath::writeFrameTimings - " << path << ", " << frames.size() << " frames, mean "
+		<< totalMs / frames.size() << " ms, p95 " << percentile(sorted, 0.95) << " ms, p99 " << percentile(sorted, 0.99)
+		<< " ms, max " << sorted.back() << " ms" << std::endl;
+}
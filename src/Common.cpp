@@ -18,3 +18,26 @@ void DestroyDebugUtilsMessengerEXT(VkInstance instance, VkDebugUtilsMessengerEXT
 		func(instance, debugMessenger, pAllocator);
 	}
 }
+
+double percentile(const std::vector<double>& sorted, double p) {
+	size_t index = static_cast<size_t>(std::ceil(p * sorted.size()));
+	return sorted[std::clamp<size_t>(index, 1, sorted.size()) - 1];
+}
+
+std::string escapeJson(const std::string& value) {
+	std::string escaped;
+	escaped.reserve(value.size());
+	for (char c : value) {
+		if (c == '"' || c == '\\') {
+			escaped += '\\';
+			escaped += c;
+		}
+		else if (static_cast<unsigned char>(c) < 0x20) {
+			escaped += ' ';
+		}
+		else {
+			escaped += c;
+		}
+	}
+	return escaped;
+}
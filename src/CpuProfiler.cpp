@@ -0,0 +1,97 @@
+#include "include/CpuProfiler.h"
+
+std::mutex CpuProfiler::s_mutex;
+std::vector<CpuProfiler::Event> CpuProfiler::s_events;
+size_t CpuProfiler::s_nextEvent = 0;
+std::atomic<bool> CpuProfiler::s_enabled{ false };
+
+// trace 의 0 은 프로세스 시작
+static const std::chrono::steady_clock::time_point s_startTime = std::chrono::steady_clock::now();
+
+CpuProfiler::Scope::Scope(const char* name)
+	: m_name(name), m_startUs(CpuProfiler::isEnabled() ? CpuProfiler::nowUs() : -1) {
+}
+
+CpuProfiler::Scope::~Scope() {
+	if (m_startUs >= 0) {
+		CpuProfiler::addEvent(m_name, m_startUs, CpuProfiler::nowUs());
+	}
+}
+
+void CpuProfiler::setEnabled(bool enabled) {
+	s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool CpuProfiler::isEnabled() {
+	return s_enabled.load(std::memory_order_relaxed);
+}
+
+void CpuProfiler::clear() {
+	std::lock_guard<std::mutex> lock(s_mutex);
+	s_events.clear();
+	s_nextEvent = 0;
+}
+
+size_t CpuProfiler::getEventCount() {
+	std::lock_guard<std::mutex> lock(s_mutex);
+	return s_events.size();
+}
+
+int64_t CpuProfiler::nowUs() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_startTime).count();
+}
+
+uint32_t CpuProfiler::getThreadId() {
+	// 처음 기록한 순서대로 1, 2, ... (main thread 가 1)
+	static std::atomic<uint32_t> nextId{ 1 };
+	thread_local uint32_t id = nextId++;
+	return id;
+}
+
+void CpuProfiler::addEvent(const char* name, int64_t startUs, int64_t endUs) {
+	Event event = { name, startUs, endUs - startUs, getThreadId() };
+	std::lock_guard<std::mutex> lock(s_mutex);
+	// 상한에 닿으면 가장 오래된 event 부터 덮어씀 (오래 켜 둬도 메모리가 일정, 최근 구간은 항상 남음)
+	if (s_events.size() < CPU_PROFILER_MAX_EVENTS) {
+		s_events.push_back(event);
+	}
+	else {
+		s_events[s_nextEvent] = event;
+	}
+	s_nextEvent = (s_nextEvent + 1) % CPU_PROFILER_MAX_EVENTS;
+}
+
+void CpuProfiler::writeTrace(const std::string& path) {
+	// ring buffer 를 시간 순서로 (가득 찼으면 s_nextEvent 가 가장 오래된 event)
+	std::vector<Event> events;
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+		events.reserve(s_events.size());
+		size_t first = s_events.size() < CPU_PROFILER_MAX_EVENTS ? 0 : s_nextEvent;
+		events.insert(events.end(), s_events.begin() + first, s_events.end());
+		events.insert(events.end(), s_events.begin(), s_events.begin() + first);
+	}
+
+	std::ofstream file(path);
+	if (!file.is_open()) {
+		throw std::runtime_error("failed to open file: " + path);
+	}
+
+	// complete event ("ph": "X") + thread 이름 metadata
+	std::set<uint32_t> threadIds;
+	file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	for (size_t i = 0; i < events.size(); i++) {
+		const Event& e = events[i];
+		threadIds.insert(e.threadId);
+		file << "{\"name\":\"" << escapeJson(e.name) << "\",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":" << e.startUs
+			<< ",\"dur\":" << e.durationUs << ",\"pid\":1,\"tid\":" << e.threadId << "},\n";
+	}
+	for (uint32_t threadId : threadIds) {
+		file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadId
+			<< ",\"args\":{\"name\":\"" << (threadId == 1 ? std::string("main") : "thread " + std::to_string(threadId)) << "\"}},\n";
+	}
+	file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"MyEngine\"}}\n";
+	file << "]}\n";
+
+	std::cout << "CpuProfiler::writeTrace - " << events.size() << " events, " << path << std::endl;
+}
@@ -14,14 +14,14 @@ void DescriptorSet::cleanup() {
 }
 
 std::unique_ptr<DescriptorSet> DescriptorSet::createSet0DescSet(VulkanContext* context, DescriptorSetLayout* layout,
-	UniformBuffer* cameraBuffer, UniformBuffer* optionsBuffer) {
+	UniformBuffer* optionsBuffer, StorageBuffer* rayStatsBuffer, StorageBuffer* sobolBuffer) {
 	std::unique_ptr<DescriptorSet> descSet = std::unique_ptr<DescriptorSet>(new DescriptorSet());
-	descSet->initSet0DescSet(context, layout, cameraBuffer, optionsBuffer);
+	descSet->initSet0DescSet(context, layout, optionsBuffer, rayStatsBuffer, sobolBuffer);
 	return descSet;
 }
 
 void DescriptorSet::initSet0DescSet(VulkanContext* context, DescriptorSetLayout* layout,
-	UniformBuffer* cameraBuffer, UniformBuffer* optionsBuffer) {
+	UniformBuffer* optionsBuffer, StorageBuffer* rayStatsBuffer, StorageBuffer* sobolBuffer) {
 	this->context = context;
 
 	VkDescriptorSetAllocateInfo allocInfo{};
@@ -35,20 +35,6 @@ void DescriptorSet::initSet0DescSet(VulkanContext* context, DescriptorSetLayout*
 		throw std::runtime_error("failed to allocate set0 descriptor set!");
 	}
 
-	VkDescriptorBufferInfo cameraBufferInfo{};
-	cameraBufferInfo.buffer = cameraBuffer->getBuffer();
-	cameraBufferInfo.offset = 0;
-	cameraBufferInfo.range = sizeof(CameraGPU);
-
-	VkWriteDescriptorSet cameraWrite{};
-	cameraWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-	cameraWrite.dstSet = m_descriptorSet;
-	cameraWrite.dstBinding = 0;
-	cameraWrite.dstArrayElement = 0;
-	cameraWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-	cameraWrite.descriptorCount = 1;
-	cameraWrite.pBufferInfo = &cameraBufferInfo;
-
 	VkDescriptorBufferInfo optionsBufferInfo{};
 	optionsBufferInfo.buffer = optionsBuffer->getBuffer();
 	optionsBufferInfo.offset = 0;
@@ -57,13 +43,41 @@ void DescriptorSet::initSet0DescSet(VulkanContext* context, DescriptorSetLayout*
 	VkWriteDescriptorSet optionsWrite{};
 	optionsWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
 	optionsWrite.dstSet = m_descriptorSet;
-	optionsWrite.dstBinding = 1;
+	optionsWrite.dstBinding = 0;
 	optionsWrite.dstArrayElement = 0;
 	optionsWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
 	optionsWrite.descriptorCount = 1;
 	optionsWrite.pBufferInfo = &optionsBufferInfo;
 
-	std::array<VkWriteDescriptorSet, 2> writes{ cameraWrite, optionsWrite };
+	VkDescriptorBufferInfo rayStatsBufferInfo{};
+	rayStatsBufferInfo.buffer = rayStatsBuffer->getBuffer();
+	rayStatsBufferInfo.offset = 0;
+	rayStatsBufferInfo.range = sizeof(RayStatsGPU);
+
+	VkWriteDescriptorSet rayStatsWrite{};
+	rayStatsWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	rayStatsWrite.dstSet = m_descriptorSet;
+	rayStatsWrite.dstBinding = 1;
+	rayStatsWrite.dstArrayElement = 0;
+	rayStatsWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	rayStatsWrite.descriptorCount = 1;
+	rayStatsWrite.pBufferInfo = &rayStatsBufferInfo;
+
+	VkDescriptorBufferInfo sobolBufferInfo{};
+	sobolBufferInfo.buffer = sobolBuffer->getBuffer();
+	sobolBufferInfo.offset = 0;
+	sobolBufferInfo.range = sobolBuffer->getCurrentSize();
+
+	VkWriteDescriptorSet sobolWrite{};
+	sobolWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	sobolWrite.dstSet = m_descriptorSet;
+	sobolWrite.dstBinding = 2;
+	sobolWrite.dstArrayElement = 0;
+	sobolWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	sobolWrite.descriptorCount = 1;
+	sobolWrite.pBufferInfo = &sobolBufferInfo;
+
+	std::array<VkWriteDescriptorSet, 3> writes{ optionsWrite, rayStatsWrite, sobolWrite };
 	vkUpdateDescriptorSets(context->getDevice(), static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
 }
 
@@ -160,14 +174,16 @@ void DescriptorSet::initSet2DescSet(VulkanContext* context, DescriptorSetLayout*
 }
 
 std::unique_ptr<DescriptorSet> DescriptorSet::createSet3DescSet(VulkanContext* context, DescriptorSetLayout* layout,
-	StorageBuffer* instanceBuffer, StorageBuffer* areaLightBuffer) {
+	StorageBuffer* instanceBuffer, StorageBuffer* areaLightBuffer, StorageBuffer* emissiveTriangleBuffer,
+	StorageBuffer* environmentBuffer) {
 	std::unique_ptr<DescriptorSet> descSet = std::unique_ptr<DescriptorSet>(new DescriptorSet());
-	descSet->initSet3DescSet(context, layout, instanceBuffer, areaLightBuffer);
+	descSet->initSet3DescSet(context, layout, instanceBuffer, areaLightBuffer, emissiveTriangleBuffer, environmentBuffer);
 	return descSet;
 }
 
 void DescriptorSet::initSet3DescSet(VulkanContext* context, DescriptorSetLayout* layout,
-	StorageBuffer* instanceBuffer, StorageBuffer* areaLightBuffer) {
+	StorageBuffer* instanceBuffer, StorageBuffer* areaLightBuffer, StorageBuffer* emissiveTriangleBuffer,
+	StorageBuffer* environmentBuffer) {
 	this->context = context;
 
 	VkDescriptorSetAllocateInfo allocInfo{};
@@ -209,7 +225,35 @@ void DescriptorSet::initSet3DescSet(VulkanContext* context, DescriptorSetLayout*
 	areaLightBufferWrite.descriptorCount = 1;
 	areaLightBufferWrite.pBufferInfo = &areaLightBufferInfo;
 
-	std::array<VkWriteDescriptorSet, 2> writes{ instanceBufferWrite, areaLightBufferWrite };
+	VkDescriptorBufferInfo emissiveTriangleBufferInfo{};
+	emissiveTriangleBufferInfo.buffer = emissiveTriangleBuffer->getBuffer();
+	emissiveTriangleBufferInfo.offset = 0;
+	emissiveTriangleBufferInfo.range = emissiveTriangleBuffer->getCurrentSize();
+
+	VkWriteDescriptorSet emissiveTriangleBufferWrite{};
+	emissiveTriangleBufferWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	emissiveTriangleBufferWrite.dstSet = m_descriptorSet;
+	emissiveTriangleBufferWrite.dstBinding = 2;
+	emissiveTriangleBufferWrite.dstArrayElement = 0;
+	emissiveTriangleBufferWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	emissiveTriangleBufferWrite.descriptorCount = 1;
+	emissiveTriangleBufferWrite.pBufferInfo = &emissiveTriangleBufferInfo;
+
+	VkDescriptorBufferInfo environmentBufferInfo{};
+	environmentBufferInfo.buffer = environmentBuffer->getBuffer();
+	environmentBufferInfo.offset = 0;
+	environmentBufferInfo.range = environmentBuffer->getCurrentSize();
+
+	VkWriteDescriptorSet environmentBufferWrite{};
+	environmentBufferWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	environmentBufferWrite.dstSet = m_descriptorSet;
+	environmentBufferWrite.dstBinding = 3;
+	environmentBufferWrite.dstArrayElement = 0;
+	environmentBufferWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	environmentBufferWrite.descriptorCount = 1;
+	environmentBufferWrite.pBufferInfo = &environmentBufferInfo;
+
+	std::array<VkWriteDescriptorSet, 4> writes{ instanceBufferWrite, areaLightBufferWrite, emissiveTriangleBufferWrite, environmentBufferWrite };
 	vkUpdateDescriptorSets(context->getDevice(), static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
 }
 
@@ -256,14 +300,14 @@ void DescriptorSet::initSet4DescSet(VulkanContext* context, DescriptorSetLayout*
 }
 
 std::unique_ptr<DescriptorSet> DescriptorSet::createSet5DescSet(VulkanContext* context, DescriptorSetLayout* layout,
-	Texture* output, Texture* accumPrev, Texture* accumCur) {
+	Texture* output, Texture* accum, Texture* moment, StorageBuffer* tileError) {
 	std::unique_ptr<DescriptorSet> descSet = std::unique_ptr<DescriptorSet>(new DescriptorSet());
-	descSet->initSet5DescSet(context, layout, output, accumPrev, accumCur);
+	descSet->initSet5DescSet(context, layout, output, accum, moment, tileError);
 	return descSet;
 }
 
 void DescriptorSet::initSet5DescSet(VulkanContext* context, DescriptorSetLayout* layout,
-	Texture* output, Texture* accumPrev, Texture* accumCur) {
+	Texture* output, Texture* accum, Texture* moment, StorageBuffer* tileError) {
 	this->context = context;
 
 	VkDescriptorSetAllocateInfo allocInfo{};
@@ -294,35 +338,50 @@ void DescriptorSet::initSet5DescSet(VulkanContext* context, DescriptorSetLayout*
 	outputWrite.pImageInfo = &outputImageInfo;
 	descriptorWrites.push_back(outputWrite);
 
-	VkDescriptorImageInfo accumPrevImageInfo{};
-	accumPrevImageInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
-	accumPrevImageInfo.imageView = accumPrev->getImageView();
-	accumPrevImageInfo.sampler = VK_NULL_HANDLE;
-
-	VkWriteDescriptorSet accumPrevWrite{};
-	accumPrevWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-	accumPrevWrite.dstSet = m_descriptorSet;
-	accumPrevWrite.dstBinding = 1;
-	accumPrevWrite.dstArrayElement = 0;
-	accumPrevWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-	accumPrevWrite.descriptorCount = 1;
-	accumPrevWrite.pImageInfo = &accumPrevImageInfo;
-	descriptorWrites.push_back(accumPrevWrite);
-
-	VkDescriptorImageInfo accumCurImageInfo{};
-	accumCurImageInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
-	accumCurImageInfo.imageView = accumCur->getImageView();
-	accumCurImageInfo.sampler = VK_NULL_HANDLE;
-
-	VkWriteDescriptorSet accumCurWrite{};
-	accumCurWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-	accumCurWrite.dstSet = m_descriptorSet;
-	accumCurWrite.dstBinding = 2;
-	accumCurWrite.dstArrayElement = 0;
-	accumCurWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-	accumCurWrite.descriptorCount = 1;
-	accumCurWrite.pImageInfo = &accumCurImageInfo;
-	descriptorWrites.push_back(accumCurWrite);
+	VkDescriptorImageInfo accumImageInfo{};
+	accumImageInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+	accumImageInfo.imageView = accum->getImageView();
+	accumImageInfo.sampler = VK_NULL_HANDLE;
+
+	VkWriteDescriptorSet accumWrite{};
+	accumWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	accumWrite.dstSet = m_descriptorSet;
+	accumWrite.dstBinding = 1;
+	accumWrite.dstArrayElement = 0;
+	accumWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+	accumWrite.descriptorCount = 1;
+	accumWrite.pImageInfo = &accumImageInfo;
+	descriptorWrites.push_back(accumWrite);
+
+	VkDescriptorImageInfo momentImageInfo{};
+	momentImageInfo.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+	momentImageInfo.imageView = moment->getImageView();
+	momentImageInfo.sampler = VK_NULL_HANDLE;
+
+	VkWriteDescriptorSet momentWrite{};
+	momentWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	momentWrite.dstSet = m_descriptorSet;
+	momentWrite.dstBinding = 2;
+	momentWrite.dstArrayElement = 0;
+	momentWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+	momentWrite.descriptorCount = 1;
+	momentWrite.pImageInfo = &momentImageInfo;
+	descriptorWrites.push_back(momentWrite);
+
+	VkDescriptorBufferInfo tileErrorInfo{};
+	tileErrorInfo.buffer = tileError->getBuffer();
+	tileErrorInfo.offset = 0;
+	tileErrorInfo.range = tileError->getCurrentSize();
+
+	VkWriteDescriptorSet tileErrorWrite{};
+	tileErrorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	tileErrorWrite.dstSet = m_descriptorSet;
+	tileErrorWrite.dstBinding = 3;
+	tileErrorWrite.dstArrayElement = 0;
+	tileErrorWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	tileErrorWrite.descriptorCount = 1;
+	tileErrorWrite.pBufferInfo = &tileErrorInfo;
+	descriptorWrites.push_back(tileErrorWrite);
 
 	vkUpdateDescriptorSets(context->getDevice(), static_cast<uint32_t>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
 }
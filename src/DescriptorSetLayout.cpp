@@ -21,22 +21,29 @@ std::unique_ptr<DescriptorSetLayout> DescriptorSetLayout::createSet0Layout(Vulka
 void DescriptorSetLayout::initSet0Layout(VulkanContext* context) {
 	this->context = context;
 
-	std::vector<VkDescriptorSetLayoutBinding> bindings(2);
+	std::vector<VkDescriptorSetLayoutBinding> bindings(3);
 
-	// binding 0: camera buffer
+	// binding 0: options buffer (camera, frameCount, currentSpp 는 push constant)
 	bindings[0].binding = 0;
 	bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
 	bindings[0].descriptorCount = 1;
-	bindings[0].stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR;
+	bindings[0].stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR | VK_SHADER_STAGE_MISS_BIT_KHR;
 	bindings[0].pImmutableSamplers = nullptr;
 
-	// binding 1: options buffer
+	// binding 1: ray stats buffer (RAY_STATS specialization constant 가 켜졌을 때만 사용)
 	bindings[1].binding = 1;
-	bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+	bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
 	bindings[1].descriptorCount = 1;
-	bindings[1].stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR;
+	bindings[1].stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR | VK_SHADER_STAGE_MISS_BIT_KHR;
 	bindings[1].pImmutableSamplers = nullptr;
 
+	// binding 2: Sobol direction number table (sampler)
+	bindings[2].binding = 2;
+	bindings[2].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	bindings[2].descriptorCount = 1;
+	bindings[2].stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR;
+	bindings[2].pImmutableSamplers = nullptr;
+
 	VkDescriptorSetLayoutCreateInfo layoutInfo{};
 	layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
 	layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
@@ -88,7 +95,7 @@ void DescriptorSetLayout::initSet2Layout(VulkanContext* context) {
 	binding.binding = 0;
 	binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
 	binding.descriptorCount = MAX_TEXTURE_COUNT;
-	binding.stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR;
+	binding.stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR | VK_SHADER_STAGE_MISS_BIT_KHR;
 	binding.pImmutableSamplers = nullptr;
 
 	VkDescriptorBindingFlags bindingFlag =
@@ -122,7 +129,7 @@ std::unique_ptr<DescriptorSetLayout> DescriptorSetLayout::createSet3Layout(Vulka
 void DescriptorSetLayout::initSet3Layout(VulkanContext* context) {
 	this->context = context;
 	
-	std::vector<VkDescriptorSetLayoutBinding> bindings(2);
+	std::vector<VkDescriptorSetLayoutBinding> bindings(4);
 
 	// binding 0: instance buffer
 	bindings[0].binding = 0;
@@ -138,6 +145,20 @@ void DescriptorSetLayout::initSet3Layout(VulkanContext* context) {
 	bindings[1].stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR;
 	bindings[1].pImmutableSamplers = nullptr;
 
+	// binding 2: emissive triangle buffer
+	bindings[2].binding = 2;
+	bindings[2].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	bindings[2].descriptorCount = 1;
+	bindings[2].stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR;
+	bindings[2].pImmutableSamplers = nullptr;
+
+	// binding 3: environment map 의 cell 선택 alias table (NEE 는 closest hit, MIS pdf 는 miss)
+	bindings[3].binding = 3;
+	bindings[3].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	bindings[3].descriptorCount = 1;
+	bindings[3].stageFlags = VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR | VK_SHADER_STAGE_MISS_BIT_KHR;
+	bindings[3].pImmutableSamplers = nullptr;
+
 	VkDescriptorSetLayoutCreateInfo layoutInfo{};
 	layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
 	layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
@@ -186,7 +207,7 @@ std::unique_ptr<DescriptorSetLayout> DescriptorSetLayout::createSet5Layout(Vulka
 void DescriptorSetLayout::initSet5Layout(VulkanContext* context) {
 	this->context = context;
 	
-	std::vector<VkDescriptorSetLayoutBinding> bindings(3);
+	std::vector<VkDescriptorSetLayoutBinding> bindings(4);
 
 	// binding 0: output image
 	bindings[0].binding = 0;
@@ -195,20 +216,27 @@ void DescriptorSetLayout::initSet5Layout(VulkanContext* context) {
 	bindings[0].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT | VK_SHADER_STAGE_RAYGEN_BIT_KHR;
 	bindings[0].pImmutableSamplers = nullptr;
 
-	// binding 1: accum prev image
+	// binding 1: accum image (in-place)
 	bindings[1].binding = 1;
 	bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
 	bindings[1].descriptorCount = 1;
 	bindings[1].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT | VK_SHADER_STAGE_RAYGEN_BIT_KHR;
 	bindings[1].pImmutableSamplers = nullptr;
 
-	// binding 2: accum cur image
+	// binding 2: luminance^2 누적 image (adaptive sampling)
 	bindings[2].binding = 2;
 	bindings[2].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
 	bindings[2].descriptorCount = 1;
-	bindings[2].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT | VK_SHADER_STAGE_RAYGEN_BIT_KHR;
+	bindings[2].stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR;
 	bindings[2].pImmutableSamplers = nullptr;
 
+	// binding 3: tile 별 상대 오차
+	bindings[3].binding = 3;
+	bindings[3].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	bindings[3].descriptorCount = 1;
+	bindings[3].stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR;
+	bindings[3].pImmutableSamplers = nullptr;
+
 
 	VkDescriptorSetLayoutCreateInfo layoutInfo{};
 	layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
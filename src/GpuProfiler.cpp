@@ -0,0 +1,232 @@
+#include "include/GpuProfiler.h"
+
+std::unique_ptr<GpuProfiler> GpuProfiler::createGpuProfiler(VulkanContext* context) {
+	std::unique_ptr<GpuProfiler> profiler = std::unique_ptr<GpuProfiler>(new GpuProfiler());
+	profiler->init(context);
+	return profiler;
+}
+
+GpuProfiler::~GpuProfiler() {
+	cleanup();
+}
+
+void GpuProfiler::cleanup() {
+	std::cout << "GpuProfiler::cleanup" << std::endl;
+	if (context->getGpuProfiler() == this) {
+		context->setGpuProfiler(nullptr);
+	}
+	if (m_queryPool != VK_NULL_HANDLE) {
+		vkDestroyQueryPool(context->getDevice(), m_queryPool, nullptr);
+		m_queryPool = VK_NULL_HANDLE;
+	}
+}
+
+void GpuProfiler::init(VulkanContext* context) {
+	this->context = context;
+
+	uint32_t queueFamilyCount = 0;
+	vkGetPhysicalDeviceQueueFamilyProperties(context->getPhysicalDevice(), &queueFamilyCount, nullptr);
+	std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+	vkGetPhysicalDeviceQueueFamilyProperties(context->getPhysicalDevice(), &queueFamilyCount, queueFamilies.data());
+	uint32_t validBits = queueFamilies[context->getQueueFamily()].timestampValidBits;
+
+	VkPhysicalDeviceProperties props;
+	vkGetPhysicalDeviceProperties(context->getPhysicalDevice(), &props);
+
+	if (validBits == 0 || props.limits.timestampPeriod == 0.0f) {
+		std::cout << "GpuProfiler::init - timestamps not supported on the graphics queue, profiler disabled" << std::endl;
+		return;
+	}
+	m_timestampPeriod = props.limits.timestampPeriod;
+	m_timestampMask = validBits >= 64 ? ~0ull : ((1ull << validBits) - 1);
+
+	VkQueryPoolCreateInfo poolInfo{};
+	poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+	poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+	poolInfo.queryCount = GPU_PROFILER_LATENCY * GPU_PROFILER_MAX_QUERIES;
+
+	if (vkCreateQueryPool(context->getDevice(), &poolInfo, nullptr, &m_queryPool) != VK_SUCCESS) {
+		throw std::runtime_error("failed to create timestamp query pool!");
+	}
+
+	// host reset (hostQueryReset) 이라 어떤 command buffer 에서든 zone 을 기록할 수 있음
+	vkResetQueryPool(context->getDevice(), m_queryPool, 0, poolInfo.queryCount);
+
+	m_enabled = true;
+	context->setGpuProfiler(this);
+}
+
+GpuProfiler::Scope::Scope(GpuProfiler* profiler, VkCommandBuffer cmd, const char* name) : m_profiler(profiler), m_cmd(cmd) {
+	if (m_profiler) {
+		m_profiler->beginZone(m_cmd, name);
+	}
+}
+
+GpuProfiler::Scope::~Scope() {
+	if (m_profiler) {
+		m_profiler->endZone(m_cmd);
+	}
+}
+
+void GpuProfiler::beginFrame() {
+	if (!m_enabled) {
+		return;
+	}
+	// 다음 slot 은 GPU_PROFILER_LATENCY 프레임 전에 제출된 것 → 이미 끝났으므로 기다리지 않음
+	m_currentSlot = (m_currentSlot + 1) % GPU_PROFILER_LATENCY;
+	resolveSlot(m_currentSlot);
+	m_openZones.clear();
+}
+
+void GpuProfiler::beginZone(VkCommandBuffer cmd, const char* name) {
+	// 같은 이름으로 debug label (RenderDoc / Nsight), timestamp 와 상관없이 항상
+	if (g_vkCmdBeginDebugUtilsLabelEXT) {
+		VkDebugUtilsLabelEXT label{};
+		label.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+		label.pLabelName = name;
+		g_vkCmdBeginDebugUtilsLabelEXT(cmd, &label);
+	}
+
+	if (!m_enabled) {
+		return;
+	}
+
+	FrameSlot& slot = m_slots[m_currentSlot];
+	if (slot.queryCount + 2 > GPU_PROFILER_MAX_QUERIES) {
+		m_openZones.push_back(-1);
+		return;
+	}
+
+	Zone zone;
+	zone.name = name;
+	zone.depth = static_cast<uint32_t>(m_openZones.size());
+	zone.beginQuery = m_currentSlot * GPU_PROFILER_MAX_QUERIES + slot.queryCount;
+	zone.endQuery = zone.beginQuery + 1;
+	slot.queryCount += 2;
+
+	vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_queryPool, zone.beginQuery);
+	m_openZones.push_back(static_cast<int32_t>(slot.zones.size()));
+	slot.zones.push_back(zone);
+}
+
+void GpuProfiler::endZone(VkCommandBuffer cmd) {
+	if (g_vkCmdEndDebugUtilsLabelEXT) {
+		g_vkCmdEndDebugUtilsLabelEXT(cmd);
+	}
+
+	if (!m_enabled || m_openZones.empty()) {
+		return;
+	}
+
+	int32_t zoneIndex = m_openZones.back();
+	m_openZones.pop_back();
+	if (zoneIndex < 0) {
+		return;
+	}
+	vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_queryPool, m_slots[m_currentSlot].zones[zoneIndex].endQuery);
+}
+
+void GpuProfiler::flush() {
+	if (!m_enabled) {
+		return;
+	}
+	vkDeviceWaitIdle(context->getDevice());
+	for (uint32_t i = 1; i <= GPU_PROFILER_LATENCY; i++) {
+		resolveSlot((m_currentSlot + i) % GPU_PROFILER_LATENCY);
+	}
+	m_openZones.clear();
+}
+
+void GpuProfiler::resetStats() {
+	for (auto& stats : m_zoneStats) {
+		stats.totalMs = 0.0;
+		stats.sampleCount = 0;
+	}
+}
+
+const GpuZoneStats* GpuProfiler::findZoneStats(const std::string& name) const {
+	for (const auto& stats : m_zoneStats) {
+		if (stats.name == name) {
+			return &stats;
+		}
+	}
+	return nullptr;
+}
+
+void GpuProfiler::resolveSlot(uint32_t slotIndex) {
+	FrameSlot& slot = m_slots[slotIndex];
+	uint32_t firstQuery = slotIndex * GPU_PROFILER_MAX_QUERIES;
+
+	if (slot.queryCount > 0) {
+		// [timestamp, availability] 쌍
+		std::vector<uint64_t> results(static_cast<size_t>(slot.queryCount) * 2);
+		vkGetQueryPoolResults(context->getDevice(), m_queryPool, firstQuery, slot.queryCount,
+			results.size() * sizeof(uint64_t), results.data(), 2 * sizeof(uint64_t),
+			VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+
+		// 같은 이름의 zone 은 한 프레임 안에서 합산
+		std::vector<std::pair<const Zone*, float>> frameZones;
+		float totalMs = 0.0f;
+		for (const auto& zone : slot.zones) {
+			size_t begin = static_cast<size_t>(zone.beginQuery - firstQuery) * 2;
+			size_t end = static_cast<size_t>(zone.endQuery - firstQuery) * 2;
+			if (results[begin + 1] == 0 || results[end + 1] == 0) {
+				continue;
+			}
+			uint64_t t0 = results[begin] & m_timestampMask;
+			uint64_t t1 = results[end] & m_timestampMask;
+			float ms = t1 > t0 ? static_cast<float>(static_cast<double>(t1 - t0) * m_timestampPeriod / 1e6) : 0.0f;
+
+			auto it = std::find_if(frameZones.begin(), frameZones.end(), [&](const auto& z) { return z.first->name == zone.name; });
+			if (it != frameZones.end()) {
+				it->second += ms;
+			}
+			else {
+				frameZones.push_back({ &zone, ms });
+			}
+			if (zone.depth == 0) {
+				totalMs += ms;
+			}
+		}
+
+		if (!frameZones.empty()) {
+			addSample("gpu total", 0, totalMs);
+		}
+		for (const auto& [zone, ms] : frameZones) {
+			addSample(zone->name, zone->depth + 1, ms);
+		}
+	}
+
+	vkResetQueryPool(context->getDevice(), m_queryPool, firstQuery, GPU_PROFILER_MAX_QUERIES);
+	slot.zones.clear();
+	slot.queryCount = 0;
+}
+
+void GpuProfiler::addSample(const std::string& name, uint32_t depth, float ms) {
+	GpuZoneStats* stats = nullptr;
+	for (auto& s : m_zoneStats) {
+		if (s.name == name) {
+			stats = &s;
+			break;
+		}
+	}
+	if (stats == nullptr) {
+		m_zoneStats.push_back(GpuZoneStats());
+		stats = &m_zoneStats.back();
+		stats->name = name;
+	}
+
+	stats->depth = depth;
+	stats->lastMs = ms;
+	stats->history[stats->historyOffset] = ms;
+	stats->historyOffset = (stats->historyOffset + 1) % GPU_PROFILER_HISTORY;
+	stats->historyCount = std::min(stats->historyCount + 1, GPU_PROFILER_HISTORY);
+	stats->totalMs += ms;
+	stats->sampleCount++;
+
+	float sum = 0.0f;
+	for (uint32_t i = 0; i < stats->historyCount; i++) {
+		sum += stats->history[i];
+	}
+	stats->avgMs = sum / stats->historyCount;
+}
@@ -41,6 +41,7 @@ void GuiRenderer::init(VulkanContext* context, GLFWwindow* window, RenderPass* r
 	init_info.Queue = context->getGraphicsQueue();
 	init_info.QueueFamily = context->getQueueFamily();
 	init_info.DescriptorPool = m_descriptorPool;
+	init_info.PipelineCache = context->getPipelineCache();
 	init_info.RenderPass = renderPass->getRenderPass();
 	init_info.MinImageCount = swapChain->getSwapChainImages().size();
 	init_info.ImageCount = swapChain->getSwapChainImages().size();
@@ -93,7 +94,7 @@ void GuiRenderer::createDescriptorPool() {
 	}
  }
 
-void GuiRenderer::render(VkCommandBuffer cmd, OptionsGPU& options, Scene &scene, float deltaTime) {
+void GuiRenderer::render(VkCommandBuffer cmd, OptionsGPU& options, Scene &scene, GpuProfiler* profiler, RayStats& rayStats, const AdaptiveStats& adaptiveStats, float deltaTime) {
     static ImGuiDockNodeFlags dockspace_flags = ImGuiDockNodeFlags_None;
     ImGuiWindowFlags window_flags = ImGuiWindowFlags_MenuBar | ImGuiWindowFlags_NoDocking;
     const ImGuiViewport* viewport = ImGui::GetMainViewport();
@@ -146,7 +147,18 @@ void GuiRenderer::render(VkCommandBuffer cmd, OptionsGPU& options, Scene &scene,
 		ImGuiWindowFlags_NoBackground;
 
 	ImGui::SetNextWindowBgAlpha(0.35f); // 반투명
-	ImVec2 windowSize = ImVec2(140, 120);
+	size_t gpuZoneCount = (profiler && profiler->isEnabled()) ? profiler->getZoneStats().size() : 0;
+	ImVec2 windowSize = gpuZoneCount > 0 ? ImVec2(220, 190.0f + 17.0f * gpuZoneCount) : ImVec2(220, 140);
+	windowSize.y += rayStats.enabled ? 170.0f : 25.0f;
+	windowSize.y += options.adaptive ? 95.0f : 25.0f;
+	windowSize.y += 47.0f;	// Record / Save Trace
+
+	const MemoryTracker* memory = context->getMemoryTracker();
+	uint32_t memoryLines = 1 + static_cast<uint32_t>(memory->getHeapStats().size());
+	for (uint32_t i = static_cast<uint32_t>(MemoryCategory::Geometry); i < static_cast<uint32_t>(MemoryCategory::Count); i++) {
+		memoryLines += memory->getCategoryCount(static_cast<MemoryCategory>(i)) > 0 ? 1 : 0;
+	}
+	windowSize.y += 8.0f + 17.0f * memoryLines;
 	ImVec2 windowPos = ImVec2(
 		viewport->WorkPos.x + viewport->WorkSize.x - windowSize.x - 20.0f,
 		viewport->WorkPos.y + 50.0f
@@ -165,12 +177,94 @@ void GuiRenderer::render(VkCommandBuffer cmd, OptionsGPU& options, Scene &scene,
 	if (ImGui::DragInt("Max SPP", &options.maxSpp, 1, 1, 99999)) {
 		options.currentSpp = -1;
 	}
+
+	// adaptive sampling (수렴한 tile 은 trace 안 함, 모든 tile 이 수렴하면 정지)
+	bool adaptive = options.adaptive != 0;
+	if (ImGui::Checkbox("Adaptive", &adaptive)) {
+		options.adaptive = adaptive ? 1 : 0;
+		options.currentSpp = -1;
+	}
+	if (adaptive) {
+		if (ImGui::DragFloat("Target Error", &options.adaptiveError, 0.001f, 0.001f, 1.0f, "%.3f") |
+			ImGui::DragInt("Min SPP", &options.adaptiveMinSpp, 1, ADAPTIVE_MIN_SPP_LIMIT, 4096)) {
+			options.adaptiveError = std::max(options.adaptiveError, 0.001f);
+			options.adaptiveMinSpp = std::max(options.adaptiveMinSpp, ADAPTIVE_MIN_SPP_LIMIT);
+			options.currentSpp = -1;
+		}
+		ImGui::Text("Active tiles: %u / %u", adaptiveStats.activeTiles, adaptiveStats.tileCount);
+		ImGui::Text("Max error: %.4f", adaptiveStats.maxError);
+	}
+
+	// GPU timestamp (GPU_PROFILER_LATENCY 프레임 지연, GPU_PROFILER_HISTORY 프레임 평균)
+	if (gpuZoneCount > 0) {
+		ImGui::Separator();
+		for (const auto& zone : profiler->getZoneStats()) {
+			ImGui::Text("%*s%s: %.3f ms", static_cast<int>(zone.depth * 2), "", zone.name.c_str(), zone.avgMs);
+		}
+		const GpuZoneStats* total = profiler->findZoneStats("gpu total");
+		if (total) {
+			ImGui::PlotLines("##gpu", total->history.data(), GPU_PROFILER_HISTORY, total->historyOffset,
+				nullptr, 0.0f, FLT_MAX, ImVec2(windowSize.x - 20.0f, 50.0f));
+		}
+	}
+
+	// ray / path counter (켜면 pipeline 재생성)
+	ImGui::Separator();
+	ImGui::Checkbox("Ray Stats", &rayStats.enabled);
+	if (rayStats.enabled) {
+		ImGui::Text("%.1f Mrays/s", rayStats.raysPerSecond / 1e6);
+		ImGui::Text("Primary: %llu", static_cast<unsigned long long>(rayStats.depthRays[0]));
+		ImGui::Text("Shadow: %llu", static_cast<unsigned long long>(rayStats.shadowRays));
+		ImGui::Text("RR kills: %llu", static_cast<unsigned long long>(rayStats.rouletteKills));
+		ImGui::Text("Miss: %llu", static_cast<unsigned long long>(rayStats.missTerminations));
+		ImGui::Text("Light hits: %llu", static_cast<unsigned long long>(rayStats.lightHits));
+
+		std::array<float, RAY_STATS_MAX_DEPTH> depthRays;
+		for (uint32_t d = 0; d < RAY_STATS_MAX_DEPTH; d++) {
+			depthRays[d] = static_cast<float>(rayStats.depthRays[d]);
+		}
+		ImGui::PlotHistogram("##depth", depthRays.data(), RAY_STATS_MAX_DEPTH, 0, "rays / depth",
+			0.0f, FLT_MAX, ImVec2(windowSize.x - 20.0f, 40.0f));
+	}
+
+	// device memory: heap 은 driver 의 usage / budget, 아래는 category 별 tracked
+	ImGui::Separator();
+	const float mb = 1024.0f * 1024.0f;
+	ImGui::Text("Mem: %.1f MB (peak %.1f)", memory->getTotalBytes() / mb, memory->getPeakBytes() / mb);
+	const std::vector<MemoryHeapStats>& heaps = memory->getHeapStats();
+	for (size_t i = 0; i < heaps.size(); i++) {
+		ImGui::Text("%s %zu: %.0f / %.0f MB%s", heaps[i].deviceLocal ? "VRAM" : "Host", i,
+			heaps[i].usage / mb, heaps[i].budget / mb, memory->hasBudget() ? "" : "*");
+	}
+	for (uint32_t i = static_cast<uint32_t>(MemoryCategory::Geometry); i < static_cast<uint32_t>(MemoryCategory::Count); i++) {
+		MemoryCategory category = static_cast<MemoryCategory>(i);
+		if (memory->getCategoryCount(category) > 0) {
+			ImGui::Text("  %s: %.1f MB", MemoryTracker::getCategoryName(category), memory->getCategoryBytes(category) / mb);
+		}
+	}
+
+	// 켠 뒤부터 지금까지의 CPU 구간 (chrome://tracing / Perfetto)
+	ImGui::Separator();
+	bool recording = CpuProfiler::isEnabled();
+	if (ImGui::Checkbox("Record", &recording)) {
+		CpuProfiler::setEnabled(recording);
+	}
+	ImGui::SameLine();
+	if (ImGui::Button("Save Trace")) {
+		try {
+			CpuProfiler::writeTrace(CPU_TRACE_PATH);
+		}
+		catch (const std::exception& e) {
+			std::cerr << "GuiRenderer::render - " << e.what() << std::endl;
+		}
+	}
+	ImGui::Text("%zu events", CpuProfiler::getEventCount());
 	ImGui::End();
 
     // Viewport 창
     ImGui::Begin("Viewport");
     m_viewportSize = ImGui::GetContentRegionAvail();
-    ImGui::Image((ImTextureID)(uint64_t)m_viewPortDescriptorSet[0], m_viewportSize);
+    ImGui::Image((ImTextureID)(uint64_t)m_viewPortDescriptorSet[0], m_viewportSize, ImVec2(0.0f, 0.0f), m_viewportUV);
     ImGui::End();
 
     // Scene Object Inspector 창
@@ -281,6 +375,12 @@ void GuiRenderer::createViewPortDescriptorSet(std::array<Texture*, 2> textures)
 	m_viewPortDescriptorSet[1] = ImGui_ImplVulkan_AddTexture(textures[1]->getSampler(), textures[1]->getImageView(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 }
 
+void GuiRenderer::setViewportRegion(VkExtent2D renderExtent, VkExtent2D allocExtent) {
+	m_viewportUV = ImVec2(
+		static_cast<float>(renderExtent.width) / static_cast<float>(allocExtent.width),
+		static_cast<float>(renderExtent.height) / static_cast<float>(allocExtent.height));
+}
+
 
 void GuiRenderer::setDarkThemeColors()
 {
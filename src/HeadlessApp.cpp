@@ -0,0 +1,553 @@
+#include "include/HeadlessApp.h"
+#include <sstream>
+#include <cfloat>
+
+HeadlessApp::HeadlessApp(const HeadlessSettings& settings) : m_settings(settings) {
+	init();
+}
+
+HeadlessApp::~HeadlessApp() {
+	cleanup();
+}
+
+void HeadlessApp::init() {
+	std::cout << "HeadlessApp::init" << std::endl;
+	if (m_settings.benchmark) {
+		// 고정된 해상도 / spp, renderer 는 runBenchmark 에서 scene 마다 만듦
+		m_settings.spp = (m_settings.warmupFrames + m_settings.benchmarkFrames) * m_settings.sppPerFrame;
+		return;
+	}
+	m_renderer = Renderer::createHeadlessRenderer(m_settings);
+}
+
+void HeadlessApp::run() {
+	std::cout << "HeadlessApp::run" << std::endl;
+	if (m_settings.benchmark) {
+		runBenchmark();
+		return;
+	}
+	if (!m_settings.cameraPath.empty()) {
+		runCameraPath();
+		return;
+	}
+	if (!m_settings.goldenPath.empty()) {
+		runGolden();
+		return;
+	}
+	if (m_renderer->isTiled()) {
+		m_renderer->renderTiled(m_settings.outputPath);
+		return;
+	}
+	m_renderer->renderOffline();
+	m_renderer->saveImage(m_settings.outputPath);
+}
+
+void HeadlessApp::cleanup() {
+	std::cout << "HeadlessApp::cleanup" << std::endl;
+}
+
+// interactive 와 같은 방식: 프레임마다 sppPerFrame 만큼 trace, camera 가 움직이면 누적 reset
+void HeadlessApp::runCameraPath() {
+	CpuProfiler::Scope cpuZone("camera path");
+	if (m_renderer->isTiled()) {
+		throw std::runtime_error("camera path playback does not support tiled rendering!");
+	}
+
+	std::unique_ptr<CameraPath> path = CameraPath::createCameraPath(m_settings.cameraPath);
+	uint32_t frameCount = path->getFrameCount(m_settings.cameraPathFps);
+	GpuProfiler* profiler = m_renderer->getGpuProfiler();
+	std::vector<CameraPathFrame> frames;
+	frames.reserve(frameCount);
+
+	CameraKeyframe prevKey;
+	for (uint32_t i = 0; i < frameCount; i++) {
+		CameraKeyframe key = path->evaluate(i / m_settings.cameraPathFps);
+		m_renderer->setCamera(key.position, CameraPath::getDirection(key.yaw, key.pitch), key.fovY);
+		if (i == 0 || key.position != prevKey.position || key.yaw != prevKey.yaw || key.pitch != prevKey.pitch || key.fovY != prevKey.fovY) {
+			m_renderer->resetAccumulation();
+		}
+		prevKey = key;
+
+		const GpuZoneStats* trace = profiler->findZoneStats("trace");
+		double traceMsBefore = trace ? trace->totalMs : 0.0;
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		m_renderer->traceSamples(m_settings.sppPerFrame);
+		auto endTime = std::chrono::high_resolution_clock::now();
+
+		profiler->flush();
+		trace = profiler->findZoneStats("trace");
+
+		CameraPathFrame frame;
+		frame.frame = static_cast<int32_t>(i);
+		frame.time = key.time;
+		frame.frameMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+		frame.gpuMs = trace ? trace->totalMs - traceMsBefore : 0.0;
+		frame.spp = m_renderer->getCurrentSpp();
+		frames.push_back(frame);
+	}
+
+	CameraPath::writeFrameTimings(m_settings.cameraPathOutput, frames);
+	m_renderer->saveImage(m_settings.outputPath);
+}
+
+// 고정 seed / spp 로 렌더링해서 golden 과 비교, spp 가 2 배가 될 때마다 error 측정
+void HeadlessApp::runGolden() {
+	CpuProfiler::Scope cpuZone("golden");
+	if (m_renderer->isTiled()) {
+		throw std::runtime_error("golden comparison does not support tiled rendering!");
+	}
+
+	uint32_t goldenWidth = 0;
+	uint32_t goldenHeight = 0;
+	std::vector<float> golden = ImageIO::readImage(m_settings.goldenPath, goldenWidth, goldenHeight);
+	VkExtent2D extent = m_renderer->getExtent();
+	if (goldenWidth != extent.width || goldenHeight != extent.height) {
+		throw std::runtime_error("golden image is " + std::to_string(goldenWidth) + " x " + std::to_string(goldenHeight) +
+			" but the render is " + std::to_string(extent.width) + " x " + std::to_string(extent.height) + "!");
+	}
+	std::cout << "HeadlessApp::runGolden " << m_settings.goldenPath << ", " << m_settings.spp << " spp, seed " << m_settings.seed << std::endl;
+
+	int32_t samplesPerSubmit = std::max(m_settings.samplesPerSubmit, 1);
+	std::vector<ErrorSample> curve;
+	double seconds = 0.0;
+	int32_t checkpoint = 1;
+
+	m_renderer->resetAccumulation();
+	m_renderer->resetRayStats();
+	while (!m_renderer->isConverged()) {
+		auto startTime = std::chrono::high_resolution_clock::now();
+		while (m_renderer->getCurrentSpp() < checkpoint && !m_renderer->isConverged()) {
+			m_renderer->traceSamples(std::min(samplesPerSubmit, checkpoint - m_renderer->getCurrentSpp()));
+		}
+		auto endTime = std::chrono::high_resolution_clock::now();
+		seconds += std::chrono::duration<double>(endTime - startTime).count();
+
+		ErrorSample sample;
+		sample.spp = m_renderer->getCurrentSpp();
+		sample.seconds = seconds;
+		sample.error = ImageIO::compareImages(m_renderer->readAccumImage(), golden);
+		curve.push_back(sample);
+		std::cout << "  " << sample.spp << " spp, " << sample.seconds << " s: RMSE " << sample.error.rmse
+			<< ", relMSE " << sample.error.relMse << std::endl;
+
+		checkpoint = std::min(checkpoint * 2, m_settings.spp);
+	}
+
+	m_renderer->saveImage(m_settings.outputPath);
+	if (!m_settings.errorCurvePath.empty()) {
+		writeErrorCurve(curve);
+	}
+
+	const ImageError& error = curve.back().error;
+	if (m_settings.goldenTolerance > 0.0 && error.relMse > m_settings.goldenTolerance) {
+		throw std::runtime_error("golden mismatch: relMSE " + std::to_string(error.relMse) +
+			" > " + std::to_string(m_settings.goldenTolerance) + "!");
+	}
+	std::cout << "HeadlessApp::runGolden - relMSE " << error.relMse
+		<< (m_settings.goldenTolerance > 0.0 ? " (pass)" : "") << std::endl;
+}
+
+void HeadlessApp::writeErrorCurve(const std::vector<ErrorSample>& curve) {
+	std::ofstream file(m_settings.errorCurvePath);
+	if (!file.is_open()) {
+		throw std::runtime_error("failed to open file: " + m_settings.errorCurvePath);
+	}
+
+	file << std::setprecision(8);
+	file << "spp,seconds,rmse,relMse\n";
+	for (const ErrorSample& sample : curve) {
+		file << sample.spp << "," << sample.seconds << "," << sample.error.rmse << "," << sample.error.relMse << "\n";
+	}
+	std::cout << "HeadlessApp::writeErrorCurve - " << m_settings.errorCurvePath << std::endl;
+}
+
+void HeadlessApp::runBenchmark() {
+	CpuProfiler::Scope cpuZone("benchmark");
+	// 고정 scene / 시점
+	// default: 2M triangle 나무 + 그림 + 전구 (BVH 위주)
+	// lion: default 에 1k texture 3 장 (base color / normal / ARM) 짜리 47k triangle glTF 를 바닥에 추가 (texture fetch 위주)
+	const std::vector<BenchmarkScene> scenes = {
+		{ "default", "", glm::vec3(0.0f), 1.0f, {
+			{ "front",   glm::vec3( 0.0f, 0.0f,  5.0f), glm::vec3( 0.0f,  0.0f, -1.0f), 50.0f },
+			{ "corner",  glm::vec3( 1.6f, 2.0f,  3.0f), glm::vec3(-0.5f, -0.4f, -1.0f), 60.0f },
+			{ "closeup", glm::vec3(-0.8f, 0.2f,  1.2f), glm::vec3(-0.4f, -0.3f, -0.5f), 40.0f },
+		} },
+		{ "lion", "assets/lion_head_1k/lion_head_1k.gltf", glm::vec3(0.9f, -1.0f, 0.4f), 2.0f, {
+			{ "lion front",  glm::vec3( 0.9f, -0.55f, 1.6f), glm::vec3( 0.0f,  0.0f,  -1.0f), 35.0f },
+			{ "lion corner", glm::vec3(-1.2f,  0.5f,  2.5f), glm::vec3( 2.1f, -1.05f, -2.1f), 50.0f },
+		} },
+	};
+
+	std::vector<BenchmarkMemory> memory;
+	std::vector<BenchmarkResult> results;
+	for (const auto& scene : scenes) {
+		HeadlessSettings settings = m_settings;
+		settings.scene = "default";
+		settings.modelPath = scene.modelPath;
+		settings.modelPosition = scene.modelPosition;
+		settings.modelScale = scene.modelScale;
+		settings.environmentPath = "";
+		settings.overrideCamera = false;
+		m_renderer.reset();
+		m_renderer = Renderer::createHeadlessRenderer(settings);
+
+		for (const auto& view : scene.views) {
+			results.push_back(benchmarkView(view));
+			results.back().scene = scene.name;
+		}
+		memory.push_back(collectBenchmarkMemory(scene));
+	}
+	writeBenchmarkJson(memory, results);
+}
+
+HeadlessApp::BenchmarkResult HeadlessApp::benchmarkView(const BenchmarkView& view) {
+	std::cout << "HeadlessApp::benchmarkView " << view.name << std::endl;
+	m_renderer->setCamera(view.camPos, view.camDir, view.fovY);
+	m_renderer->resetAccumulation();
+
+	for (int32_t i = 0; i < m_settings.warmupFrames; i++) {
+		m_renderer->traceSamples(m_settings.sppPerFrame);
+	}
+	GpuProfiler* profiler = m_renderer->getGpuProfiler();
+	profiler->flush();
+	profiler->resetStats();
+	m_renderer->resetRayStats();
+
+	std::vector<double> frameMs;
+	frameMs.reserve(m_settings.benchmarkFrames);
+	for (int32_t i = 0; i < m_settings.benchmarkFrames; i++) {
+		auto startTime = std::chrono::high_resolution_clock::now();
+		m_renderer->traceSamples(m_settings.sppPerFrame);
+		auto endTime = std::chrono::high_resolution_clock::now();
+		frameMs.push_back(std::chrono::duration<double, std::milli>(endTime - startTime).count());
+	}
+
+	BenchmarkResult result;
+	result.view = view.name;
+	profiler->flush();
+	for (const auto& zone : profiler->getZoneStats()) {
+		if (zone.sampleCount > 0) {
+			result.gpuZoneMs.push_back({ zone.name, zone.totalMs / zone.sampleCount });
+		}
+	}
+	if (frameMs.empty()) {
+		return result;
+	}
+
+	double totalMs = 0.0;
+	for (double ms : frameMs) {
+		totalMs += ms;
+	}
+	std::vector<double> sorted = frameMs;
+	std::sort(sorted.begin(), sorted.end());
+
+	VkExtent2D extent = m_renderer->getExtent();
+	double samplesPerFrame = static_cast<double>(extent.width) * extent.height * m_settings.sppPerFrame;
+
+	result.meanMs = totalMs / frameMs.size();
+	result.medianMs = percentile(sorted, 0.5);
+	result.p95Ms = percentile(sorted, 0.95);
+	result.p99Ms = percentile(sorted, 0.99);
+	result.minMs = sorted.front();
+	result.maxMs = sorted.back();
+	result.samplesPerSecond = samplesPerFrame * frameMs.size() / (totalMs / 1000.0);
+	if (m_settings.rayStats) {
+		result.raysPerSecond = m_renderer->getRayStats().accumulatedRays / (totalMs / 1000.0);
+	}
+	else {
+		// counter 가 꺼져 있으면 camera ray 기준
+		result.raysPerSecond = result.samplesPerSecond;
+	}
+
+	std::cout << "  mean " << result.meanMs << " ms, p99 " << result.p99Ms << " ms, "
+		<< result.samplesPerSecond / 1e6 << " Msamples/s" << std::endl;
+	return result;
+}
+
+HeadlessApp::BenchmarkMemory HeadlessApp::collectBenchmarkMemory(const BenchmarkScene& scene) {
+	MemoryTracker* memory = m_renderer->getMemoryTracker();
+	memory->updateBudget();
+	const double mb = 1024.0 * 1024.0;
+
+	BenchmarkMemory result;
+	result.scene = scene.name;
+	result.modelPath = scene.modelPath;
+	result.budgetExtension = memory->hasBudget();
+	result.trackedMB = memory->getTotalBytes() / mb;
+	result.peakMB = memory->getPeakBytes() / mb;
+	for (uint32_t i = static_cast<uint32_t>(MemoryCategory::Geometry); i < static_cast<uint32_t>(MemoryCategory::Count); i++) {
+		MemoryCategory category = static_cast<MemoryCategory>(i);
+		result.categoriesMB.push_back({ MemoryTracker::getCategoryName(category), memory->getCategoryBytes(category) / mb });
+	}
+	result.heaps = memory->getHeapStats();
+	return result;
+}
+
+void HeadlessApp::writeBenchmarkJson(const std::vector<BenchmarkMemory>& scenes, const std::vector<BenchmarkResult>& results) {
+	std::ofstream file(m_settings.benchmarkOutput);
+	if (!file.is_open()) {
+		throw std::runtime_error("failed to open file: " + m_settings.benchmarkOutput);
+	}
+
+	VkExtent2D extent = m_renderer->getExtent();
+	file << std::fixed << std::setprecision(4);
+	file << "{\n";
+	file << "  \"device\": \"" << escapeJson(m_renderer->getDeviceName()) << "\",\n";
+	file << "  \"width\": " << extent.width << ",\n";
+	file << "  \"height\": " << extent.height << ",\n";
+	file << "  \"sppPerFrame\": " << m_settings.sppPerFrame << ",\n";
+	file << "  \"warmupFrames\": " << m_settings.warmupFrames << ",\n";
+	file << "  \"frames\": " << m_settings.benchmarkFrames << ",\n";
+	file << "  \"rayCountSource\": \"" << (m_settings.rayStats ? "counters" : "primary") << "\",\n";
+
+	// scene 마다 마지막 view 이후의 device memory (MB)
+	const double mb = 1024.0 * 1024.0;
+	file << "  \"scenes\": [\n";
+	for (size_t i = 0; i < scenes.size(); i++) {
+		const BenchmarkMemory& s = scenes[i];
+		file << "    {\n";
+		file << "      \"name\": \"" << escapeJson(s.scene) << "\",\n";
+		file << "      \"model\": \"" << escapeJson(s.modelPath) << "\",\n";
+		file << "      \"memory\": {\n";
+		file << "        \"budgetExtension\": " << (s.budgetExtension ? "true" : "false") << ",\n";
+		file << "        \"trackedMB\": " << s.trackedMB << ",\n";
+		file << "        \"peakMB\": " << s.peakMB << ",\n";
+		file << "        \"categoriesMB\": {";
+		for (size_t j = 0; j < s.categoriesMB.size(); j++) {
+			file << (j > 0 ? ", " : " ") << "\"" << escapeJson(s.categoriesMB[j].first) << "\": " << s.categoriesMB[j].second;
+		}
+		file << " },\n";
+		file << "        \"heaps\": [";
+		for (size_t j = 0; j < s.heaps.size(); j++) {
+			file << (j > 0 ? ", " : " ") << "{ \"deviceLocal\": " << (s.heaps[j].deviceLocal ? "true" : "false")
+				<< ", \"sizeMB\": " << s.heaps[j].size / mb << ", \"budgetMB\": " << s.heaps[j].budget / mb
+				<< ", \"usageMB\": " << s.heaps[j].usage / mb << ", \"trackedMB\": " << s.heaps[j].tracked / mb << " }";
+		}
+		file << " ]\n";
+		file << "      }\n";
+		file << "    }" << (i + 1 < scenes.size() ? "," : "") << "\n";
+	}
+	file << "  ],\n";
+	file << "  \"views\": [\n";
+	for (size_t i = 0; i < results.size(); i++) {
+		const BenchmarkResult& r = results[i];
+		file << "    {\n";
+		file << "      \"scene\": \"" << escapeJson(r.scene) << "\",\n";
+		file << "      \"name\": \"" << escapeJson(r.view) << "\",\n";
+		file << "      \"meanMs\": " << r.meanMs << ",\n";
+		file << "      \"medianMs\": " << r.medianMs << ",\n";
+		file << "      \"p95Ms\": " << r.p95Ms << ",\n";
+		file << "      \"p99Ms\": " << r.p99Ms << ",\n";
+		file << "      \"minMs\": " << r.minMs << ",\n";
+		file << "      \"maxMs\": " << r.maxMs << ",\n";
+		file << "      \"samplesPerSecond\": " << r.samplesPerSecond << ",\n";
+		file << "      \"raysPerSecond\": " << r.raysPerSecond << ",\n";
+		file << "      \"gpuMs\": {";
+		for (size_t j = 0; j < r.gpuZoneMs.size(); j++) {
+			file << (j > 0 ? ", " : " ") << "\"" << escapeJson(r.gpuZoneMs[j].first) << "\": " << r.gpuZoneMs[j].second;
+		}
+		file << " }\n";
+		file << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+	}
+	file << "  ]\n";
+	file << "}\n";
+
+	std::cout << "HeadlessApp::writeBenchmarkJson - " << m_settings.benchmarkOutput << std::endl;
+}
+
+template <typename T>
+static T parseNumber(const std::string& flag, const std::string& value, T minValue, T maxValue) {
+	std::istringstream stream(value);
+	T number{};
+	if (!(stream >> number) || !(stream >> std::ws).eof() || number < minValue || number > maxValue) {
+		throw std::runtime_error("invalid value for " + flag + ": " + value);
+	}
+	return number;
+}
+
+static glm::vec3 parseVec3(const std::string& value) {
+	glm::vec3 v(0.0f);
+	if (sscanf(value.c_str(), "%f,%f,%f", &v.x, &v.y, &v.z) != 3) {
+		throw std::runtime_error("expected x,y,z but got: " + value);
+	}
+	return v;
+}
+
+bool HeadlessApp::parseCommandLine(int argc, char** argv, HeadlessSettings& settings) {
+	bool headless = false;
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		auto next = [&]() -> std::string {
+			if (i + 1 >= argc) {
+				throw std::runtime_error("missing value for " + arg);
+			}
+			return argv[++i];
+		};
+		// 숫자 값은 전체가 숫자여야 함 (아니면 어느 flag 인지 알려줌)
+		auto nextInt = [&]() { return static_cast<int32_t>(parseNumber<int64_t>(arg, next(), INT32_MIN, INT32_MAX)); };
+		auto nextUint = [&]() { return static_cast<uint32_t>(parseNumber<int64_t>(arg, next(), 0, UINT32_MAX)); };
+		auto nextFloat = [&]() { return parseNumber<float>(arg, next(), -FLT_MAX, FLT_MAX); };
+		auto nextDouble = [&]() { return parseNumber<double>(arg, next(), -DBL_MAX, DBL_MAX); };
+
+		if (arg == "--headless") {
+			headless = true;
+		}
+		else if (arg == "--benchmark") {
+			headless = true;
+			settings.benchmark = true;
+		}
+		else if (arg == "--benchmark-output") {
+			settings.benchmarkOutput = next();
+		}
+		else if (arg == "--warmup") {
+			settings.warmupFrames = nextInt();
+		}
+		else if (arg == "--frames") {
+			settings.benchmarkFrames = nextInt();
+		}
+		else if (arg == "--trace") {
+			settings.tracePath = next();
+		}
+		else if (arg == "--ray-stats") {
+			settings.rayStats = true;
+		}
+		else if (arg == "--spp-per-frame") {
+			settings.sppPerFrame = nextInt();
+		}
+		else if (arg == "--width") {
+			settings.width = nextUint();
+		}
+		else if (arg == "--height") {
+			settings.height = nextUint();
+		}
+		else if (arg == "--spp") {
+			settings.spp = nextInt();
+		}
+		else if (arg == "--spp-per-submit") {
+			settings.samplesPerSubmit = nextInt();
+		}
+		else if (arg == "--adaptive") {
+			settings.adaptiveError = nextFloat();
+		}
+		else if (arg == "--adaptive-min-spp") {
+			settings.adaptiveMinSpp = nextInt();
+		}
+		else if (arg == "--camera-path") {
+			settings.cameraPath = next();
+		}
+		else if (arg == "--camera-path-output") {
+			settings.cameraPathOutput = next();
+		}
+		else if (arg == "--camera-path-fps") {
+			settings.cameraPathFps = nextFloat();
+		}
+		else if (arg == "--seed") {
+			settings.seed = nextInt();
+		}
+		else if (arg == "--golden") {
+			headless = true;
+			settings.goldenPath = next();
+		}
+		else if (arg == "--golden-tolerance") {
+			settings.goldenTolerance = nextDouble();
+		}
+		else if (arg == "--error-curve") {
+			settings.errorCurvePath = next();
+		}
+		else if (arg == "--tile-size") {
+			settings.tileSize = nextUint();
+		}
+		else if (arg == "--scene") {
+			settings.scene = next();
+		}
+		else if (arg == "--model") {
+			settings.modelPath = next();
+		}
+		else if (arg == "--model-scale") {
+			settings.modelScale = nextFloat();
+		}
+		else if (arg == "--model-pos") {
+			settings.modelPosition = parseVec3(next());
+		}
+		else if (arg == "--env") {
+			settings.environmentPath = next();
+		}
+		else if (arg == "--env-intensity") {
+			settings.environmentIntensity = nextFloat();
+		}
+		else if (arg == "--camera-pos") {
+			settings.camPos = parseVec3(next());
+			settings.overrideCamera = true;
+		}
+		else if (arg == "--camera-dir") {
+			settings.camDir = parseVec3(next());
+			settings.overrideCamera = true;
+		}
+		else if (arg == "--fov") {
+			settings.fovY = nextFloat();
+		}
+		else if (arg == "--output" || arg == "-o") {
+			settings.outputPath = next();
+		}
+		else if (arg == "--help" || arg == "-h") {
+			printUsage();
+			exit(EXIT_SUCCESS);
+		}
+		else {
+			throw std::runtime_error("unknown argument: " + arg);
+		}
+	}
+
+	if (settings.width == 0 || settings.height == 0 || settings.spp <= 0) {
+		throw std::runtime_error("width, height and spp must be positive!");
+	}
+	if (!settings.cameraPath.empty() && settings.cameraPathFps <= 0.0f) {
+		throw std::runtime_error("camera path fps must be positive!");
+	}
+	if (settings.benchmark && (settings.warmupFrames < 0 || settings.benchmarkFrames <= 0 || settings.sppPerFrame <= 0)) {
+		throw std::runtime_error("benchmark frames and spp per frame must be positive!");
+	}
+	return headless;
+}
+
+void HeadlessApp::printUsage() {
+	std::cout <<
+		"usage: MyEngine [--headless | --benchmark] [options]\n"
+		"  --width <n> --height <n>      output resolution (default 1280 x 720)\n"
+		"  --spp <n>                     samples per pixel (default 256)\n"
+		"  --spp-per-submit <n>          samples recorded per queue submit (default 8)\n"
+		"  --adaptive <err>              stop 16 x 16 pixel tiles once their relative error is below err,\n"
+		"                                finish early when every tile has converged (--spp is the cap)\n"
+		"  --adaptive-min-spp <n>        samples before a tile may stop (default 16)\n"
+		"  --scene <default|empty>       built-in scene\n"
+		"  --model <path.gltf>           extra glTF model (at the origin unless --model-pos x,y,z)\n"
+		"  --model-scale <s>\n"
+		"  --env <path.hdr|path.pfm>     equirectangular environment light (importance sampled)\n"
+		"  --env-intensity <s>           environment radiance scale (default 1)\n"
+		"  --camera-pos x,y,z --camera-dir x,y,z --fov <deg>\n"
+		"  -o, --output <path>           .png, .hdr, .pfm or .ppm (default output.png)\n"
+		"  --tile-size <n>               trace n x n tiles and stream them to a .pfm / .ppm output\n"
+		"                                (automatic above 4096 x 4096)\n"
+		"  --ray-stats                   count rays / path terminations with shader atomics\n"
+		"  --trace <path>                record CPU zones from startup, write Chrome trace-event JSON on exit\n"
+		"                                (also works without --headless)\n"
+		"  --seed <n>                    first frame index for the random sequence (default 0)\n"
+		"camera path playback (interactive, or offline with --headless):\n"
+		"  --camera-path <file>          keyframes, one per line: time x y z yaw pitch fov\n"
+		"                                played at a fixed time step, the window closes at the end\n"
+		"  --camera-path-fps <n>         playback frames per path second (default 60)\n"
+		"  --camera-path-output <path>   per-frame CSV: frame, time, frameMs, gpuMs, spp\n"
+		"                                (default camera_path.csv), headless uses --spp-per-frame\n"
+		"golden image regression (implies --headless):\n"
+		"  --golden <ref.pfm|ref.hdr>    compare with a converged reference (render it with -o ref.pfm at a\n"
+		"                                much higher --spp and a different --seed, so its noise is not\n"
+		"                                correlated with the test), measuring RMSE / relMSE each time the\n"
+		"                                spp doubles up to --spp\n"
+		"  --golden-tolerance <relMSE>   fail (non-zero exit) if the final relMSE is larger\n"
+		"  --error-curve <path.csv>      write spp, trace seconds, RMSE, relMSE per measurement\n"
+		"benchmark (fixed scenes and camera views: default, default + textured lion head glTF):\n"
+		"  --warmup <n> --frames <n>     warm-up / measured frames per view (default 16 / 128)\n"
+		"  --spp-per-frame <n>           samples per measured frame (default 1)\n"
+		"  --benchmark-output <path>     JSON results (default benchmark.json)\n";
+}
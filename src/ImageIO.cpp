@@ -0,0 +1,253 @@
+#include "include/ImageIO.h"
+#include <filesystem>
+#include <stb_image_write.h>
+#include "stb_image.h"
+
+void ImageIO::writeImage(const std::string& path, uint32_t width, uint32_t height, const std::vector<float>& rgba) {
+	std::string extension = std::filesystem::path(path).extension().string();
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+	if (extension == ".png") {
+		writePNG(path, width, height, rgba);
+	}
+	else if (extension == ".hdr") {
+		writeHDR(path, width, height, rgba);
+	}
+	else if (extension == ".pfm") {
+		writePFM(path, width, height, rgba);
+	}
+	else if (extension == ".ppm") {
+		// TiledImageWriter 와 같은 인코딩
+		std::unique_ptr<TiledImageWriter> writer = TiledImageWriter::createTiledImageWriter(path, width, height);
+		writer->writeTile(0, 0, width, height, rgba);
+	}
+	else if (extension == ".exr") {
+		throw std::runtime_error("EXR output is not supported, use .pfm or .hdr for float output!");
+	}
+	else {
+		throw std::runtime_error("unknown image format: " + path);
+	}
+}
+
+std::vector<float> ImageIO::readImage(const std::string& path, uint32_t& width, uint32_t& height) {
+	std::string extension = std::filesystem::path(path).extension().string();
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+	if (extension == ".pfm") {
+		return readPFM(path, width, height);
+	}
+	if (extension == ".hdr") {
+		int w, h, channels;
+		float* data = stbi_loadf(path.c_str(), &w, &h, &channels, 4);
+		if (!data) {
+			throw std::runtime_error("failed to load hdr: " + path);
+		}
+		width = static_cast<uint32_t>(w);
+		height = static_cast<uint32_t>(h);
+		std::vector<float> rgba(data, data + static_cast<size_t>(w) * h * 4);
+		stbi_image_free(data);
+		return rgba;
+	}
+	throw std::runtime_error("image must be .pfm or .hdr: " + path);
+}
+
+std::vector<float> ImageIO::readPFM(const std::string& path, uint32_t& width, uint32_t& height) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file.is_open()) {
+		throw std::runtime_error("failed to open file: " + path);
+	}
+
+	// "PF" = RGB, "Pf" = gray, scale 부호로 endian 구분, 행은 아래에서 위로
+	std::string magic;
+	float scale = 0.0f;
+	file >> magic >> width >> height >> scale;
+	file.get();
+	if ((magic != "PF" && magic != "Pf") || width == 0 || height == 0 || !file) {
+		throw std::runtime_error("invalid pfm header: " + path);
+	}
+	if (scale > 0.0f) {
+		throw std::runtime_error("big endian pfm is not supported: " + path);
+	}
+
+	uint32_t channels = magic == "PF" ? 3 : 1;
+	std::vector<float> row(static_cast<size_t>(width) * channels);
+	std::vector<float> rgba(static_cast<size_t>(width) * height * 4);
+	for (int32_t y = static_cast<int32_t>(height) - 1; y >= 0; y--) {
+		if (!file.read(reinterpret_cast<char*>(row.data()), row.size() * sizeof(float))) {
+			throw std::runtime_error("truncated pfm: " + path);
+		}
+		for (uint32_t x = 0; x < width; x++) {
+			size_t dst = (static_cast<size_t>(y) * width + x) * 4;
+			rgba[dst + 0] = row[x * channels + 0];
+			rgba[dst + 1] = row[x * channels + (channels - 1) / 2];
+			rgba[dst + 2] = row[x * channels + (channels - 1)];
+			rgba[dst + 3] = 1.0f;
+		}
+	}
+	return rgba;
+}
+
+ImageError ImageIO::compareImages(const std::vector<float>& rgba, const std::vector<float>& reference) {
+	if (rgba.size() != reference.size()) {
+		throw std::runtime_error("image sizes do not match!");
+	}
+
+	double squaredError = 0.0;
+	double relSquaredError = 0.0;
+	for (size_t i = 0; i < rgba.size(); i += 4) {
+		for (size_t c = 0; c < 3; c++) {
+			double ref = reference[i + c];
+			double diff = static_cast<double>(rgba[i + c]) - ref;
+			squaredError += diff * diff;
+			relSquaredError += diff * diff / (ref * ref + IMAGE_REL_MSE_EPSILON);
+		}
+	}
+
+	double count = std::max<double>(static_cast<double>(rgba.size() / 4 * 3), 1.0);
+	ImageError error;
+	error.rmse = std::sqrt(squaredError / count);
+	error.relMse = relSquaredError / count;
+	return error;
+}
+
+float ImageIO::linearToSRGB(float value) {
+	value = std::clamp(value, 0.0f, 1.0f);
+	if (value <= 0.0031308f) {
+		return value * 12.92f;
+	}
+	return 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+}
+
+void ImageIO::writePNG(const std::string& path, uint32_t width, uint32_t height, const std::vector<float>& rgba) {
+	// viewport 와 같은 결과가 되도록 sRGB 로 인코딩 (swapchain 이 B8G8R8A8_SRGB)
+	std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+	for (size_t i = 0; i < pixels.size(); i += 4) {
+		pixels[i + 0] = static_cast<uint8_t>(linearToSRGB(rgba[i + 0]) * 255.0f + 0.5f);
+		pixels[i + 1] = static_cast<uint8_t>(linearToSRGB(rgba[i + 1]) * 255.0f + 0.5f);
+		pixels[i + 2] = static_cast<uint8_t>(linearToSRGB(rgba[i + 2]) * 255.0f + 0.5f);
+		pixels[i + 3] = 255;
+	}
+
+	if (!stbi_write_png(path.c_str(), width, height, 4, pixels.data(), width * 4)) {
+		throw std::runtime_error("failed to write png: " + path);
+	}
+}
+
+void ImageIO::writeHDR(const std::string& path, uint32_t width, uint32_t height, const std::vector<float>& rgba) {
+	if (!stbi_write_hdr(path.c_str(), width, height, 4, rgba.data())) {
+		throw std::runtime_error("failed to write hdr: " + path);
+	}
+}
+
+void ImageIO::writePFM(const std::string& path, uint32_t width, uint32_t height, const std::vector<float>& rgba) {
+	std::ofstream file(path, std::ios::binary);
+	if (!file.is_open()) {
+		throw std::runtime_error("failed to open file: " + path);
+	}
+
+	// "PF" = RGB, 음수 scale = little endian, 행은 아래에서 위로
+	file << "PF\n" << width << " " << height << "\n-1.0\n";
+	std::vector<float> row(static_cast<size_t>(width) * 3);
+	for (int32_t y = static_cast<int32_t>(height) - 1; y >= 0; y--) {
+		for (uint32_t x = 0; x < width; x++) {
+			size_t src = (static_cast<size_t>(y) * width + x) * 4;
+			row[x * 3 + 0] = rgba[src + 0];
+			row[x * 3 + 1] = rgba[src + 1];
+			row[x * 3 + 2] = rgba[src + 2];
+		}
+		file.write(reinterpret_cast<const char*>(row.data()), row.size() * sizeof(float));
+	}
+}
+
+std::unique_ptr<TiledImageWriter> TiledImageWriter::createTiledImageWriter(const std::string& path, uint32_t width, uint32_t height) {
+	std::unique_ptr<TiledImageWriter> writer = std::unique_ptr<TiledImageWriter>(new TiledImageWriter());
+	writer->init(path, width, height);
+	return writer;
+}
+
+TiledImageWriter::~TiledImageWriter() {
+	cleanup();
+}
+
+void TiledImageWriter::cleanup() {
+	if (m_file.is_open()) {
+		m_file.close();
+	}
+}
+
+void TiledImageWriter::init(const std::string& path, uint32_t width, uint32_t height) {
+	m_path = path;
+	m_width = width;
+	m_height = height;
+
+	std::string extension = std::filesystem::path(path).extension().string();
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+	if (extension == ".pfm") {
+		m_isFloat = true;
+		m_pixelBytes = 3 * sizeof(float);
+	}
+	else if (extension == ".ppm") {
+		m_isFloat = false;
+		m_pixelBytes = 3;
+	}
+	else {
+		throw std::runtime_error("tiled output must be .pfm or .ppm: " + path);
+	}
+
+	m_file.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!m_file.is_open()) {
+		throw std::runtime_error("failed to open file: " + path);
+	}
+
+	// "PF" = RGB float, 음수 scale = little endian / "P6" = RGB 8bit
+	if (m_isFloat) {
+		m_file << "PF\n" << width << " " << height << "\n-1.0\n";
+	}
+	else {
+		m_file << "P6\n" << width << " " << height << "\n255\n";
+	}
+	m_headerSize = m_file.tellp();
+
+	// 전체 크기를 미리 잡아 두고 tile 은 seek 해서 기록
+	std::streamoff fileSize = m_headerSize + static_cast<std::streamoff>(width) * height * m_pixelBytes;
+	m_file.seekp(fileSize - 1);
+	m_file.put('\0');
+	if (!m_file) {
+		throw std::runtime_error("failed to allocate file: " + path);
+	}
+}
+
+void TiledImageWriter::writeTile(uint32_t x, uint32_t y, uint32_t tileWidth, uint32_t tileHeight, const std::vector<float>& rgba) {
+	if (x + tileWidth > m_width || y + tileHeight > m_height) {
+		throw std::runtime_error("tile is outside of the image: " + m_path);
+	}
+
+	std::vector<char> row(static_cast<size_t>(tileWidth) * m_pixelBytes);
+	for (uint32_t ty = 0; ty < tileHeight; ty++) {
+		for (uint32_t tx = 0; tx < tileWidth; tx++) {
+			size_t src = (static_cast<size_t>(ty) * tileWidth + tx) * 4;
+			if (m_isFloat) {
+				float* dst = reinterpret_cast<float*>(row.data()) + tx * 3;
+				dst[0] = rgba[src + 0];
+				dst[1] = rgba[src + 1];
+				dst[2] = rgba[src + 2];
+			}
+			else {
+				uint8_t* dst = reinterpret_cast<uint8_t*>(row.data()) + tx * 3;
+				dst[0] = static_cast<uint8_t>(ImageIO::linearToSRGB(rgba[src + 0]) * 255.0f + 0.5f);
+				dst[1] = static_cast<uint8_t>(ImageIO::linearToSRGB(rgba[src + 1]) * 255.0f + 0.5f);
+				dst[2] = static_cast<uint8_t>(ImageIO::linearToSRGB(rgba[src + 2]) * 255.0f + 0.5f);
+			}
+		}
+
+		// pfm 은 행이 아래에서 위로
+		uint32_t fileRow = m_isFloat ? m_height - 1 - (y + ty) : y + ty;
+		std::streamoff offset = m_headerSize + (static_cast<std::streamoff>(fileRow) * m_width + x) * m_pixelBytes;
+		m_file.seekp(offset);
+		m_file.write(row.data(), row.size());
+	}
+	m_file.flush();
+	if (!m_file) {
+		throw std::runtime_error("failed to write tile: " + m_path);
+	}
+}
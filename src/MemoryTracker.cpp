@@ -0,0 +1,122 @@
+#include "include/MemoryTracker.h"
+
+std::unique_ptr<MemoryTracker> MemoryTracker::createMemoryTracker(VkPhysicalDevice physicalDevice, bool budgetSupported) {
+	std::unique_ptr<MemoryTracker> tracker = std::unique_ptr<MemoryTracker>(new MemoryTracker());
+	tracker->init(physicalDevice, budgetSupported);
+	return tracker;
+}
+
+MemoryTracker::~MemoryTracker() {
+	cleanup();
+}
+
+void MemoryTracker::cleanup() {
+	std::cout << "MemoryTracker::cleanup" << std::endl;
+	if (!m_allocations.empty()) {
+		std::cout << "MemoryTracker::cleanup - " << m_allocations.size() << " allocations ("
+			<< m_totalBytes / (1024.0 * 1024.0) << " MB) not freed" << std::endl;
+	}
+}
+
+void MemoryTracker::init(VkPhysicalDevice physicalDevice, bool budgetSupported) {
+	m_physicalDevice = physicalDevice;
+	m_budgetSupported = budgetSupported;
+
+	VkPhysicalDeviceMemoryProperties memProperties;
+	vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memProperties);
+
+	m_typeToHeap.resize(memProperties.memoryTypeCount);
+	for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
+		m_typeToHeap[i] = memProperties.memoryTypes[i].heapIndex;
+	}
+	m_heaps.resize(memProperties.memoryHeapCount);
+	for (uint32_t i = 0; i < memProperties.memoryHeapCount; i++) {
+		m_heaps[i].size = memProperties.memoryHeaps[i].size;
+		m_heaps[i].deviceLocal = (memProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
+	}
+	updateBudget();
+
+	std::cout << "MemoryTracker::init - " << m_heaps.size() << " heaps, VK_EXT_memory_budget "
+		<< (m_budgetSupported ? "on" : "off") << std::endl;
+}
+
+void MemoryTracker::trackAllocation(VkDeviceMemory memory, VkDeviceSize size, uint32_t memoryTypeIndex, MemoryCategory category) {
+	Allocation allocation;
+	allocation.size = size;
+	allocation.heapIndex = m_typeToHeap[memoryTypeIndex];
+	allocation.category = category;
+	m_allocations[memory] = allocation;
+
+	m_categoryBytes[static_cast<uint32_t>(category)] += size;
+	m_categoryCount[static_cast<uint32_t>(category)]++;
+	m_heaps[allocation.heapIndex].tracked += size;
+	m_totalBytes += size;
+	m_peakBytes = std::max(m_peakBytes, m_totalBytes);
+}
+
+void MemoryTracker::trackFree(VkDeviceMemory memory) {
+	auto it = m_allocations.find(memory);
+	if (it == m_allocations.end()) {
+		return;
+	}
+	const Allocation& allocation = it->second;
+	m_categoryBytes[static_cast<uint32_t>(allocation.category)] -= allocation.size;
+	m_categoryCount[static_cast<uint32_t>(allocation.category)]--;
+	m_heaps[allocation.heapIndex].tracked -= allocation.size;
+	m_totalBytes -= allocation.size;
+	m_allocations.erase(it);
+}
+
+void MemoryTracker::updateBudget() {
+	if (!m_budgetSupported) {
+		for (auto& heap : m_heaps) {
+			heap.budget = heap.size;
+			heap.usage = heap.tracked;
+		}
+		return;
+	}
+
+	VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties{};
+	budgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+	VkPhysicalDeviceMemoryProperties2 memProperties2{};
+	memProperties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+	memProperties2.pNext = &budgetProperties;
+	vkGetPhysicalDeviceMemoryProperties2(m_physicalDevice, &memProperties2);
+
+	for (uint32_t i = 0; i < m_heaps.size(); i++) {
+		m_heaps[i].budget = budgetProperties.heapBudget[i];
+		m_heaps[i].usage = budgetProperties.heapUsage[i];
+	}
+}
+
+void MemoryTracker::printReport() const {
+	const double mb = 1024.0 * 1024.0;
+	std::cout << "  mem tracked: " << m_totalBytes / mb << " MB (peak " << m_peakBytes / mb << " MB)" << std::endl;
+	for (uint32_t i = static_cast<uint32_t>(MemoryCategory::Geometry); i < static_cast<uint32_t>(MemoryCategory::Count); i++) {
+		if (m_categoryCount[i] == 0) {
+			continue;
+		}
+		std::cout << "  mem   " << getCategoryName(static_cast<MemoryCategory>(i)) << ": "
+			<< m_categoryBytes[i] / mb << " MB in " << m_categoryCount[i] << " allocations" << std::endl;
+	}
+	for (uint32_t i = 0; i < m_heaps.size(); i++) {
+		const MemoryHeapStats& heap = m_heaps[i];
+		std::cout << "  mem heap " << i << (heap.deviceLocal ? " (device)" : " (host)") << ": "
+			<< heap.usage / mb << " / " << heap.budget / mb << " MB" << (m_budgetSupported ? "" : " (no budget ext)")
+			<< ", tracked " << heap.tracked / mb << " MB" << std::endl;
+	}
+}
+
+const char* MemoryTracker::getCategoryName(MemoryCategory category) {
+	switch (category) {
+	case MemoryCategory::Geometry: return "geometry";
+	case MemoryCategory::Textures: return "textures";
+	case MemoryCategory::AccelerationStructure: return "acceleration structures";
+	case MemoryCategory::Scratch: return "scratch";
+	case MemoryCategory::RenderTargets: return "render targets";
+	case MemoryCategory::Staging: return "staging";
+	case MemoryCategory::Buffers: return "buffers";
+	default: return "unknown";
+	}
+}
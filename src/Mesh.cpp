@@ -13,6 +13,8 @@ void Mesh::init(VulkanContext* context, std::vector<Vertex>& vertices, std::vect
 
 	m_vertexBuffer = VertexBuffer::createVertexBuffer(context, vertices);
 	m_indexBuffer = IndexBuffer::createIndexBuffer(context, indices);
+	m_vertices = vertices;
+	m_indices = indices;
 }
 
 void Mesh::calculateTangents(std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
@@ -73,7 +73,7 @@ void Pipeline::initComposite(VulkanContext* context, std::vector<DescriptorSetLa
 	pipelineInfo.stage = shaderStageInfo;
 	pipelineInfo.layout = m_pipelineLayout;
 
-	if (vkCreateComputePipelines(context->getDevice(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_pipeline) != VK_SUCCESS) {
+	if (vkCreateComputePipelines(context->getDevice(), context->getPipelineCache(), 1, &pipelineInfo, nullptr, &m_pipeline) != VK_SUCCESS) {
 		throw std::runtime_error("failed to create Composite compute pipeline!");
 	}
 
@@ -29,7 +29,7 @@ void RayTracingPipeline::cleanup() {
 		m_sbtBuffer = VK_NULL_HANDLE;
 	}
 	if (m_sbtMemory != VK_NULL_HANDLE) {
-		vkFreeMemory(context->getDevice(), m_sbtMemory, nullptr);
+		VulkanUtil::freeMemory(context, m_sbtMemory);
 		m_sbtMemory = VK_NULL_HANDLE;
 	}
 	if (m_pipeline != VK_NULL_HANDLE) {
@@ -43,13 +43,13 @@ void RayTracingPipeline::cleanup() {
 	
 }
 
-std::unique_ptr<RayTracingPipeline> RayTracingPipeline::createPtPipeline(VulkanContext* context, std::vector<DescriptorSetLayout*> descriptorSetLayouts) {
+std::unique_ptr<RayTracingPipeline> RayTracingPipeline::createPtPipeline(VulkanContext* context, std::vector<DescriptorSetLayout*> descriptorSetLayouts, bool enableRayStats) {
 	std::unique_ptr<RayTracingPipeline> pipeline = std::unique_ptr<RayTracingPipeline>(new RayTracingPipeline());
-	pipeline->initPt(context, descriptorSetLayouts);
+	pipeline->initPt(context, descriptorSetLayouts, enableRayStats);
 	return pipeline;
 }	
 
-void RayTracingPipeline::initPt(VulkanContext* context, std::vector<DescriptorSetLayout*> descriptorSetLayouts) {
+void RayTracingPipeline::initPt(VulkanContext* context, std::vector<DescriptorSetLayout*> descriptorSetLayouts, bool enableRayStats) {
 	this->context = context;
 
 	auto rgenCode = VulkanUtil::readFile("spv/pathTracing.rgen.spv");
@@ -105,15 +105,35 @@ void RayTracingPipeline::initPt(VulkanContext* context, std::vector<DescriptorSe
 		layouts.push_back(dsl->getDescriptorSetLayout());
 	}
 
+	VkPushConstantRange pushConstantRange{};
+	pushConstantRange.stageFlags = VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR | VK_SHADER_STAGE_MISS_BIT_KHR;
+	pushConstantRange.offset = 0;
+	pushConstantRange.size = sizeof(FramePushConstants);
+
 	VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
 	pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
 	pipelineLayoutInfo.setLayoutCount = static_cast<uint32_t>(layouts.size());
 	pipelineLayoutInfo.pSetLayouts = layouts.data();
+	pipelineLayoutInfo.pushConstantRangeCount = 1;
+	pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
 
 	if (vkCreatePipelineLayout(context->getDevice(), &pipelineLayoutInfo, nullptr, &m_pipelineLayout) != VK_SUCCESS) {
 		throw std::runtime_error("failed to create ray tracing pipeline layout!");
 	}
 
+	// constant_id 0: RAY_STATS (false 면 counter 코드가 driver 에서 제거됨)
+	VkBool32 rayStatsValue = enableRayStats ? VK_TRUE : VK_FALSE;
+	VkSpecializationMapEntry rayStatsEntry{};
+	rayStatsEntry.constantID = 0;
+	rayStatsEntry.offset = 0;
+	rayStatsEntry.size = sizeof(VkBool32);
+
+	VkSpecializationInfo specializationInfo{};
+	specializationInfo.mapEntryCount = 1;
+	specializationInfo.pMapEntries = &rayStatsEntry;
+	specializationInfo.dataSize = sizeof(VkBool32);
+	specializationInfo.pData = &rayStatsValue;
+
 	std::vector<VkPipelineShaderStageCreateInfo> shaderStages;
 
 	VkPipelineShaderStageCreateInfo rgenStage{};
@@ -121,6 +141,7 @@ void RayTracingPipeline::initPt(VulkanContext* context, std::vector<DescriptorSe
 	rgenStage.stage = VK_SHADER_STAGE_RAYGEN_BIT_KHR;
 	rgenStage.module = rgenModule;
 	rgenStage.pName = "main";
+	rgenStage.pSpecializationInfo = &specializationInfo;
 	shaderStages.push_back(rgenStage);
 
 	VkPipelineShaderStageCreateInfo rmissStage{};
@@ -128,6 +149,7 @@ void RayTracingPipeline::initPt(VulkanContext* context, std::vector<DescriptorSe
 	rmissStage.stage = VK_SHADER_STAGE_MISS_BIT_KHR;
 	rmissStage.module = rmissModule;
 	rmissStage.pName = "main";
+	rmissStage.pSpecializationInfo = &specializationInfo;
 	shaderStages.push_back(rmissStage);
 
 	VkPipelineShaderStageCreateInfo shadowMissStage{};
@@ -142,6 +164,7 @@ void RayTracingPipeline::initPt(VulkanContext* context, std::vector<DescriptorSe
 	rchitStage.stage = VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR;
 	rchitStage.module = rchitModule;
 	rchitStage.pName = "main";
+	rchitStage.pSpecializationInfo = &specializationInfo;
 	shaderStages.push_back(rchitStage);
 
 	VkRayTracingPipelineCreateInfoKHR pipelineInfo{};
@@ -153,9 +176,14 @@ void RayTracingPipeline::initPt(VulkanContext* context, std::vector<DescriptorSe
 	pipelineInfo.maxPipelineRayRecursionDepth = 4;
 	pipelineInfo.layout = m_pipelineLayout;
 
-	if (g_vkCreateRayTracingPipelinesKHR(context->getDevice(), VK_NULL_HANDLE, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_pipeline) != VK_SUCCESS) {
+	auto startTime = std::chrono::high_resolution_clock::now();
+	if (g_vkCreateRayTracingPipelinesKHR(context->getDevice(), VK_NULL_HANDLE, context->getPipelineCache(), 1, &pipelineInfo, nullptr, &m_pipeline) != VK_SUCCESS) {
 		throw std::runtime_error("failed to create ray tracing pipeline!");
 	}
+	auto endTime = std::chrono::high_resolution_clock::now();
+	std::cout << "RayTracingPipeline::initPt - pipeline created in "
+		<< std::chrono::duration<float, std::milli>(endTime - startTime).count() << " ms ("
+		<< (context->isPipelineCacheWarm() ? "warm" : "cold") << " cache" << (enableRayStats ? ", ray stats" : "") << ")" << std::endl;
 
 	vkDestroyShaderModule(context->getDevice(), rgenModule, nullptr);
 	vkDestroyShaderModule(context->getDevice(), rmissModule, nullptr);
@@ -217,7 +245,7 @@ void RayTracingPipeline::initPt(VulkanContext* context, std::vector<DescriptorSe
 	VulkanUtil::copyBuffer(context, stagingBuffer, m_sbtBuffer, sbtSize);
 
 	vkDestroyBuffer(context->getDevice(), stagingBuffer, nullptr);
-	vkFreeMemory(context->getDevice(), stagingMemory, nullptr);
+	VulkanUtil::freeMemory(context, stagingMemory);
 
 	VkDeviceAddress sbtAddress = VulkanUtil::getDeviceAddress(context, m_sbtBuffer);
 
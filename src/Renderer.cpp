@@ -1,8 +1,14 @@
 #include "include/Renderer.h"
 
-std::unique_ptr<Renderer> Renderer::createRenderer(GLFWwindow* window) {
+std::unique_ptr<Renderer> Renderer::createRenderer(GLFWwindow* window, const std::string& environmentPath, float environmentIntensity) {
 	std::unique_ptr<Renderer> renderer = std::unique_ptr<Renderer>(new Renderer());
-	renderer->init(window);
+	renderer->init(window, environmentPath, environmentIntensity);
+	return renderer;
+}
+
+std::unique_ptr<Renderer> Renderer::createHeadlessRenderer(const HeadlessSettings& settings) {
+	std::unique_ptr<Renderer> renderer = std::unique_ptr<Renderer>(new Renderer());
+	renderer->initHeadless(settings);
 	return renderer;
 }
 
@@ -12,7 +18,9 @@ Renderer::~Renderer() {
 
 void Renderer::cleanup() {
 	std::cout << "Renderer::cleanup" << std::endl;
-	vkDeviceWaitIdle(m_context->getDevice());
+	if (m_context) {
+		vkDeviceWaitIdle(m_context->getDevice());
+	}
 }
 
 
@@ -237,96 +245,483 @@ void Renderer::createScene() {
 
 }
 
-void Renderer::init(GLFWwindow* window) {
+void Renderer::init(GLFWwindow* window, const std::string& environmentPath, float environmentIntensity) {
 	std::cout << "Renderer::init" << std::endl;
+	CpuProfiler::Scope cpuZone("Renderer::init");
 	this->window = window;
-	m_context = VulkanContext::createVulkanContext(window);
-	m_swapChain = SwapChain::createSwapChain(window, m_context.get());
-	m_syncObjects = SyncObjects::createSyncObjects(m_context.get());
-	m_commandBuffers = CommandBuffers::createCommandBuffers(m_context.get());
+	{
+		CpuProfiler::Scope zone("VulkanContext");
+		m_context = VulkanContext::createVulkanContext(window);
+		m_gpuProfiler = GpuProfiler::createGpuProfiler(m_context.get());
+	}
+	{
+		CpuProfiler::Scope zone("SwapChain");
+		m_swapChain = SwapChain::createSwapChain(window, m_context.get());
+		m_syncObjects = SyncObjects::createSyncObjects(m_context.get());
+		m_commandBuffers = CommandBuffers::createCommandBuffers(m_context.get());
+	}
 	m_extent = {1280, 720};
+	m_requestedExtent = m_extent;
+	m_allocExtent = getViewportBucket(m_extent);
 
-	updateAssets();
+	{
+		CpuProfiler::Scope zone("updateAssets");
+		updateAssets();
+	}
 	createScene();
-	uploadSceneToGPU();
+	if (!environmentPath.empty()) {
+		loadEnvironment(environmentPath, environmentIntensity);
+	}
+	initPathTracer();
+
+	// gui
+	CpuProfiler::Scope guiZone("ImGui init + viewport targets");
+	m_imguiRenderPass = RenderPass::createImGuiRenderPass(m_context.get(), m_swapChain.get());
+	m_imguiFrameBuffers.resize(m_swapChain->getSwapChainImages().size());
+	for (int i = 0; i < m_swapChain->getSwapChainImages().size(); i++) {
+		m_imguiFrameBuffers[i] = FrameBuffer::createImGuiFrameBuffer(m_context.get(), m_imguiRenderPass.get(), m_swapChain->getSwapChainImageViews()[i], m_swapChain->getSwapChainExtent());
+	}
+	m_guiRenderer = GuiRenderer::createGuiRenderer(m_context.get(), window, m_imguiRenderPass.get(), m_swapChain.get());
+	m_guiRenderer->updateModel(m_models);
+
+	// output, accum textures + set5 + viewport descriptor
+	createViewportTargets();
+}
+
+void Renderer::initHeadless(const HeadlessSettings& settings) {
+	std::cout << "Renderer::initHeadless" << std::endl;
+	CpuProfiler::Scope cpuZone("Renderer::initHeadless");
+	this->window = nullptr;
+	m_headlessSettings = settings;
+	{
+		CpuProfiler::Scope zone("VulkanContext");
+		m_context = VulkanContext::createHeadlessVulkanContext();
+		m_gpuProfiler = GpuProfiler::createGpuProfiler(m_context.get());
+	}
+	m_syncObjects = SyncObjects::createSyncObjects(m_context.get());
+	m_commandBuffers = CommandBuffers::createCommandBuffers(m_context.get());
+	m_extent = { settings.width, settings.height };
+	m_imageExtent = m_extent;
+
+	// 큰 해상도는 tile 크기의 target 만 할당 (benchmark 는 항상 전체 프레임)
+	m_tileSize = settings.tileSize;
+	if (m_tileSize == 0 && static_cast<uint64_t>(settings.width) * settings.height > OFFLINE_TILE_AUTO_PIXELS) {
+		m_tileSize = OFFLINE_TILE_SIZE;
+	}
+	if (settings.benchmark) {
+		m_tileSize = 0;
+	}
+	if (m_tileSize > 0) {
+		m_extent = { std::min(m_tileSize, settings.width), std::min(m_tileSize, settings.height) };
+	}
+	m_requestedExtent = m_extent;
+	m_allocExtent = m_extent;
+
+	{
+		CpuProfiler::Scope zone("updateAssets");
+		updateAssets();
+	}
+	if (settings.scene == "default") {
+		createScene();
+	}
+	else if (settings.scene != "empty") {
+		throw std::runtime_error("unknown scene: " + settings.scene);
+	}
+
+	if (!settings.modelPath.empty()) {
+		loadTinyGLTFModel(settings.modelPath);
+		Object object;
+		object.modelIndex = static_cast<int>(m_models.size()) - 1;
+		object.position = settings.modelPosition;
+		object.scale = glm::vec3(settings.modelScale);
+		m_scene.objects.push_back(object);
+	}
+
+	if (m_scene.objects.empty()) {
+		throw std::runtime_error("headless scene has no objects!");
+	}
+
+	if (!settings.environmentPath.empty()) {
+		loadEnvironment(settings.environmentPath, settings.environmentIntensity);
+	}
+
+	if (settings.overrideCamera) {
+		lookAt(settings.camPos, settings.camDir);
+	}
+	m_camera.fovY = settings.fovY;
+	m_options.maxSpp = settings.spp;
+	m_rayStats.enabled = settings.rayStats;
+	if (settings.adaptiveError > 0.0f && !settings.benchmark) {
+		m_options.adaptive = 1;
+		m_options.adaptiveError = settings.adaptiveError;
+		m_options.adaptiveMinSpp = std::max(settings.adaptiveMinSpp, ADAPTIVE_MIN_SPP_LIMIT);
+	}
+
+	initPathTracer();
+
+	// output, accum textures + set5
+	createViewportTargets();
+}
+
+void Renderer::initPathTracer() {
+	CpuProfiler::Scope cpuZone("initPathTracer");
+	{
+		CpuProfiler::Scope zone("uploadSceneToGPU");
+		uploadSceneToGPU();
+	}
 
 	// printAllModelInfo();
 	// printAllInstanceInfo();
 	// printAllAreaLightInfo();
 
-	//output texture
-	m_outputTexture = Texture::createAttachmentTexture(m_context.get(), m_extent.width, m_extent.height, VK_FORMAT_R32G32B32A32_SFLOAT, VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_ASPECT_COLOR_BIT);
-	m_accum0Texture = Texture::createAttachmentTexture(m_context.get(), m_extent.width, m_extent.height, VK_FORMAT_R32G32B32A32_SFLOAT, VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_ASPECT_COLOR_BIT);
-	m_accum1Texture = Texture::createAttachmentTexture(m_context.get(), m_extent.width, m_extent.height, VK_FORMAT_R32G32B32A32_SFLOAT, VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_ASPECT_COLOR_BIT);
-
-
 	// descriptorset layout
-	m_set0Layout = DescriptorSetLayout::createSet0Layout(m_context.get()); // camera, options
+	m_set0Layout = DescriptorSetLayout::createSet0Layout(m_context.get()); // options
 	m_set1Layout = DescriptorSetLayout::createSet1Layout(m_context.get()); // material
 	m_set2Layout = DescriptorSetLayout::createSet2Layout(m_context.get()); // texture
 	m_set3Layout = DescriptorSetLayout::createSet3Layout(m_context.get()); // instance, arealight
 	m_set4Layout = DescriptorSetLayout::createSet4Layout(m_context.get()); // tlas
-	m_set5Layout = DescriptorSetLayout::createSet5Layout(m_context.get()); // 
+	m_set5Layout = DescriptorSetLayout::createSet5Layout(m_context.get()); // output, accum
 
 	// buffers
-	m_cameraBuffer = UniformBuffer::createUniformBuffer(m_context.get(), sizeof(CameraGPU));
 	m_optionsBuffer = UniformBuffer::createUniformBuffer(m_context.get(), sizeof(OptionsGPU));
 	m_materialBuffer = StorageBuffer::createStorageBuffer(m_context.get(), sizeof(MaterialGPU), MAX_MATERIAL_COUNT);
 	m_instanceBuffer = StorageBuffer::createStorageBuffer(m_context.get(), sizeof(InstanceGPU), MAX_OBJECT_COUNT);
 	m_areaLightBuffer = StorageBuffer::createStorageBuffer(m_context.get(), sizeof(AreaLightGPU), MAX_LIGHT_COUNT);
+	m_emissiveTriangleBuffer = StorageBuffer::createStorageBuffer(m_context.get(), sizeof(EmissiveTriangleGPU), MAX_EMISSIVE_TRIANGLE_COUNT);
+	m_environmentBuffer = StorageBuffer::createStorageBuffer(m_context.get(), sizeof(EnvironmentCellGPU), std::max<size_t>(m_environmentCells.size(), 1));
+	m_rayStatsBuffer = StorageBuffer::createStorageBuffer(m_context.get(), sizeof(RayStatsGPU), 1);
+	memset(m_rayStatsBuffer->getMappedMemory(), 0, sizeof(RayStatsGPU));
+	std::vector<uint32_t> sobolDirections = Sampler::buildSobolDirections();
+	m_sobolBuffer = StorageBuffer::createStorageBuffer(m_context.get(), sizeof(uint32_t), sobolDirections.size());
+	m_sobolBuffer->updateStorageBuffer(sobolDirections.data(), sizeof(uint32_t) * sobolDirections.size());
 
 	// acceleration structure
-	m_blas.resize(m_meshes.size());
-	for (int i = 0; i < m_meshes.size(); i++) {
-		m_blas[i] = BottomLevelAS::createBottomLevelAS(m_context.get(), m_meshes[i].get());
+	{
+		CpuProfiler::Scope zone("BLAS build");
+		m_blas.resize(m_meshes.size());
+		for (int i = 0; i < m_meshes.size(); i++) {
+			m_blas[i] = BottomLevelAS::createBottomLevelAS(m_context.get(), m_meshes[i].get());
+		}
+	}
+	{
+		CpuProfiler::Scope zone("TLAS build");
+		m_tlas = TopLevelAS::createTopLevelAS(m_context.get(), m_blas, m_instanceGPU, m_instanceTransforms);
 	}
-
-	m_tlas = TopLevelAS::createTopLevelAS(m_context.get(), m_blas, m_instanceGPU);
 
 	// pipeline
-	m_ptPipeline = RayTracingPipeline::createPtPipeline(m_context.get(), {m_set0Layout.get(), m_set1Layout.get(), m_set2Layout.get(), m_set3Layout.get(), m_set4Layout.get(), m_set5Layout.get()});
+	{
+		CpuProfiler::Scope zone("pipeline");
+		m_ptPipeline = RayTracingPipeline::createPtPipeline(m_context.get(), {m_set0Layout.get(), m_set1Layout.get(), m_set2Layout.get(), m_set3Layout.get(), m_set4Layout.get(), m_set5Layout.get()}, m_rayStats.enabled);
+		m_pipelineRayStats = m_rayStats.enabled;
+	}
 
 
 	// descriptor set
-	m_set0DescSet = DescriptorSet::createSet0DescSet(m_context.get(), m_set0Layout.get(), m_cameraBuffer.get(), m_optionsBuffer.get());
+	CpuProfiler::Scope descZone("descriptor sets");
+	m_set0DescSet = DescriptorSet::createSet0DescSet(m_context.get(), m_set0Layout.get(), m_optionsBuffer.get(), m_rayStatsBuffer.get(), m_sobolBuffer.get());
 	m_set1DescSet = DescriptorSet::createSet1DescSet(m_context.get(), m_set1Layout.get(), m_materialBuffer.get());
 	m_set2DescSet = DescriptorSet::createSet2DescSet(m_context.get(), m_set2Layout.get(), m_textures);
-	m_set3DescSet = DescriptorSet::createSet3DescSet(m_context.get(), m_set3Layout.get(), m_instanceBuffer.get(), m_areaLightBuffer.get());
+	m_set3DescSet = DescriptorSet::createSet3DescSet(m_context.get(), m_set3Layout.get(), m_instanceBuffer.get(), m_areaLightBuffer.get(), m_emissiveTriangleBuffer.get(),
+		m_environmentBuffer.get());
 	m_set4DescSet = DescriptorSet::createSet4DescSet(m_context.get(), m_set4Layout.get(), m_tlas->getHandle());
-	m_set5DescSets[0] = DescriptorSet::createSet5DescSet(m_context.get(), m_set5Layout.get(), m_outputTexture.get(), m_accum0Texture.get(), m_accum1Texture.get());
-	m_set5DescSets[1] = DescriptorSet::createSet5DescSet(m_context.get(), m_set5Layout.get(), m_outputTexture.get(), m_accum1Texture.get(), m_accum0Texture.get());
 
 	// update buffers
-	m_cameraBuffer->updateUniformBuffer(&m_camera, sizeof(CameraGPU));
 	m_optionsBuffer->updateUniformBuffer(&m_options, sizeof(OptionsGPU));
+	m_uploadedOptions = m_options;
 	m_materialBuffer->updateStorageBuffer(&m_materials[0], sizeof(MaterialGPU) * m_materials.size());
 	m_instanceBuffer->updateStorageBuffer(&m_instanceGPU[0], sizeof(InstanceGPU) * m_instanceGPU.size());
-	m_areaLightBuffer->updateStorageBuffer(&m_areaLightGPU[0], sizeof(AreaLightGPU) * m_areaLightGPU.size());
+	if (!m_areaLightGPU.empty()) {
+		m_areaLightBuffer->updateStorageBuffer(&m_areaLightGPU[0], sizeof(AreaLightGPU) * m_areaLightGPU.size());
+	}
+	if (!m_emissiveTriangleGPU.empty()) {
+		m_emissiveTriangleBuffer->updateStorageBuffer(&m_emissiveTriangleGPU[0], sizeof(EmissiveTriangleGPU) * m_emissiveTriangleGPU.size());
+	}
+	if (!m_environmentCells.empty()) {
+		m_environmentBuffer->updateStorageBuffer(&m_environmentCells[0], sizeof(EnvironmentCellGPU) * m_environmentCells.size());
+	}
+}
 
-	// gui
-	m_imguiRenderPass = RenderPass::createImGuiRenderPass(m_context.get(), m_swapChain.get());
-	m_imguiFrameBuffers.resize(m_swapChain->getSwapChainImages().size());
-	for (int i = 0; i < m_swapChain->getSwapChainImages().size(); i++) {
-		m_imguiFrameBuffers[i] = FrameBuffer::createImGuiFrameBuffer(m_context.get(), m_imguiRenderPass.get(), m_swapChain->getSwapChainImageViews()[i], m_swapChain->getSwapChainExtent());
+void Renderer::lookAt(glm::vec3 position, glm::vec3 direction) {
+	m_camera.camPos = position;
+	m_camera.camDir = glm::normalize(direction);
+	m_pitch = glm::degrees(asin(m_camera.camDir.y));
+	m_yaw = glm::degrees(atan2(m_camera.camDir.z, m_camera.camDir.x));
+
+	glm::vec3 worldUp = glm::vec3(0.0f, 1.0f, 0.0f);
+	m_camera.camRight = glm::normalize(glm::cross(m_camera.camDir, worldUp));
+	m_camera.camUp = glm::normalize(glm::cross(m_camera.camRight, m_camera.camDir));
+}
+
+void Renderer::renderOffline() {
+	std::cout << "Renderer::renderOffline " << m_extent.width << " x " << m_extent.height << ", " << m_options.maxSpp << " spp" << std::endl;
+
+	int32_t samplesPerSubmit = std::max(m_headlessSettings.samplesPerSubmit, 1);
+
+	resetAccumulation();
+	resetRayStats();
+	auto startTime = std::chrono::high_resolution_clock::now();
+
+	while (!isConverged()) {
+		traceSamples(std::min(samplesPerSubmit, m_options.maxSpp - m_options.currentSpp));
 	}
-	m_guiRenderer = GuiRenderer::createGuiRenderer(m_context.get(), window, m_imguiRenderPass.get(), m_swapChain.get());
-	m_guiRenderer->createViewPortDescriptorSet({m_outputTexture.get(), m_outputTexture.get()});
-	m_guiRenderer->updateModel(m_models);
+	if (m_options.adaptive) {
+		std::cout << "Renderer::renderOffline - adaptive stopped at " << m_options.currentSpp << " spp, "
+			<< m_adaptiveStats.activeTiles << " / " << m_adaptiveStats.tileCount << " tiles above " << m_options.adaptiveError << std::endl;
+	}
+
+	auto endTime = std::chrono::high_resolution_clock::now();
+	float seconds = std::chrono::duration<float>(endTime - startTime).count();
+	printOfflineStats(seconds, static_cast<double>(m_extent.width) * m_extent.height * m_options.currentSpp);
+}
+
+void Renderer::renderTiled(const std::string& path) {
+	uint32_t tilesX = (m_imageExtent.width + m_tileSize - 1) / m_tileSize;
+	uint32_t tilesY = (m_imageExtent.height + m_tileSize - 1) / m_tileSize;
+	std::cout << "Renderer::renderTiled " << m_imageExtent.width << " x " << m_imageExtent.height << ", " << m_options.maxSpp << " spp, "
+		<< tilesX << " x " << tilesY << " tiles of " << m_tileSize << std::endl;
+
+	// 파일을 먼저 열어서 포맷 오류는 렌더링 전에 확인
+	std::unique_ptr<TiledImageWriter> writer = TiledImageWriter::createTiledImageWriter(path, m_imageExtent.width, m_imageExtent.height);
+	int32_t samplesPerSubmit = std::max(m_headlessSettings.samplesPerSubmit, 1);
+
+	resetRayStats();
+	auto startTime = std::chrono::high_resolution_clock::now();
+
+	// dispatch 하나 = tile 한 장 x 1 spp, submit 하나 = samplesPerSubmit 개
+	for (uint32_t ty = 0; ty < tilesY; ty++) {
+		for (uint32_t tx = 0; tx < tilesX; tx++) {
+			m_tileOffset = glm::uvec2(tx * m_tileSize, ty * m_tileSize);
+			m_extent = {
+				std::min(m_tileSize, m_imageExtent.width - m_tileOffset.x),
+				std::min(m_tileSize, m_imageExtent.height - m_tileOffset.y)
+			};
+
+			resetAccumulation();
+			while (!isConverged()) {
+				traceSamples(std::min(samplesPerSubmit, m_options.maxSpp - m_options.currentSpp));
+			}
+
+			std::vector<float> pixels = readAccumImage();
+			writer->writeTile(m_tileOffset.x, m_tileOffset.y, m_extent.width, m_extent.height, pixels);
+			std::cout << "Renderer::renderTiled - tile " << ty * tilesX + tx + 1 << " / " << tilesX * tilesY << std::endl;
+		}
+	}
+
+	auto endTime = std::chrono::high_resolution_clock::now();
+	float seconds = std::chrono::duration<float>(endTime - startTime).count();
+	printOfflineStats(seconds, static_cast<double>(m_imageExtent.width) * m_imageExtent.height * m_options.maxSpp);
+	std::cout << "Renderer::renderTiled - " << path << std::endl;
+}
+
+void Renderer::printOfflineStats(float seconds, double samples) {
+	std::cout << "Renderer::renderOffline - " << seconds << " s, "
+		<< samples / std::max(seconds, 1e-6f) / 1e6 << " Msamples/s" << std::endl;
+	if (m_pipelineRayStats) {
+		std::cout << "  " << m_rayStats.accumulatedRays << " rays, "
+			<< m_rayStats.accumulatedRays / std::max(seconds, 1e-6f) / 1e6 << " Mrays/s" << std::endl;
+	}
+
+	m_gpuProfiler->flush();
+	for (const auto& zone : m_gpuProfiler->getZoneStats()) {
+		std::cout << "  gpu " << std::string(zone.depth * 2, ' ') << zone.name << ": "
+			<< zone.totalMs / std::max(zone.sampleCount, 1u) << " ms avg over " << zone.sampleCount << " submits" << std::endl;
+	}
+
+	m_context->getMemoryTracker()->updateBudget();
+	m_context->getMemoryTracker()->printReport();
+}
+
+void Renderer::resetAccumulation() {
+	m_options.currentSpp = 0;
+	m_options.frameCount = m_headlessSettings.seed;	// 난수는 frameCount 로 초기화
+}
+
+void Renderer::setCamera(glm::vec3 position, glm::vec3 direction, float fovY) {
+	lookAt(position, direction);
+	m_camera.fovY = fovY;
+}
+
+std::string Renderer::getDeviceName() {
+	VkPhysicalDeviceProperties props;
+	vkGetPhysicalDeviceProperties(m_context->getPhysicalDevice(), &props);
+	return props.deviceName;
+}
+
+void Renderer::traceSamples(int32_t sampleCount) {
+	CpuProfiler::Scope cpuZone("traceSamples");
+	VkCommandBuffer cmd = m_commandBuffers->getCommandBuffers()[currentFrame];
+	VkFence fence = m_syncObjects->getInFlightFences()[currentFrame];
+
+	vkWaitForFences(m_context->getDevice(), 1, &fence, VK_TRUE, UINT64_MAX);
+	m_gpuProfiler->beginFrame();
+	updateRayStatsPipeline();
+	vkResetFences(m_context->getDevice(), 1, &fence);
+	vkResetCommandBuffer(cmd, 0);
 
+	VkCommandBufferBeginInfo beginInfo{};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	if (vkBeginCommandBuffer(cmd, &beginInfo) != VK_SUCCESS) {
+		throw std::runtime_error("failed to begin recording command buffer!");
+	}
+
+	int32_t tracedSamples = 0;
+	for (int32_t i = 0; i < sampleCount && !isConverged(); i++) {
+		m_options.frameCount++;
+		m_pushConstants.camPos = m_camera.camPos;
+		m_pushConstants.camDir = m_camera.camDir;
+		m_pushConstants.camUp = m_camera.camUp;
+		m_pushConstants.camRight = m_camera.camRight;
+		m_pushConstants.fovY = m_camera.fovY;
+		m_pushConstants.frameCount = m_options.frameCount;
+		m_pushConstants.currentSpp = m_options.currentSpp;
+
+		recordPathTracingCommandBuffer();
+
+		// 다음 sample 이 accum 을 읽기 전에 쓰기 완료
+		VkMemoryBarrier barrier{};
+		barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+		barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR,
+			0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+		m_options.currentSpp++;
+		tracedSamples++;
+	}
+	if (tracedSamples > 0) {
+		recordAdaptiveReadback(cmd, m_options.currentSpp);
+	}
+
+	if (vkEndCommandBuffer(cmd) != VK_SUCCESS) {
+		throw std::runtime_error("failed to record command buffer!");
+	}
+
+	VkSubmitInfo submitInfo{};
+	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers = &cmd;
+
+	auto startTime = std::chrono::high_resolution_clock::now();
+	{
+		CpuProfiler::Scope zone("submit + wait");
+		if (vkQueueSubmit(m_context->getGraphicsQueue(), 1, &submitInfo, fence) != VK_SUCCESS) {
+			throw std::runtime_error("failed to submit path tracing command buffer!");
+		}
+		vkWaitForFences(m_context->getDevice(), 1, &fence, VK_TRUE, UINT64_MAX);
+	}
+	auto endTime = std::chrono::high_resolution_clock::now();
+
+	if (m_pipelineRayStats) {
+		collectRayStats(std::chrono::duration<double>(endTime - startTime).count());
+	}
+	collectAdaptiveStats();
+}
+
+void Renderer::updateRayStatsPipeline() {
+	if (m_rayStats.enabled == m_pipelineRayStats) {
+		return;
+	}
+	// RAY_STATS specialization constant 를 바꿔서 pipeline 재생성
+	vkDeviceWaitIdle(m_context->getDevice());
+	m_ptPipeline.reset();
+	m_ptPipeline = RayTracingPipeline::createPtPipeline(m_context.get(), {m_set0Layout.get(), m_set1Layout.get(), m_set2Layout.get(), m_set3Layout.get(), m_set4Layout.get(), m_set5Layout.get()}, m_rayStats.enabled);
+	m_pipelineRayStats = m_rayStats.enabled;
+
+	memset(m_rayStatsBuffer->getMappedMemory(), 0, sizeof(RayStatsGPU));
+	RayStats cleared;
+	cleared.enabled = m_rayStats.enabled;
+	m_rayStats = cleared;
+}
+
+void Renderer::collectRayStats(double traceSeconds) {
+	// fence 대기 이후에만 호출 (host coherent 메모리를 직접 읽고 0 으로 초기화)
+	RayStatsGPU counters;
+	memcpy(&counters, m_rayStatsBuffer->getMappedMemory(), sizeof(RayStatsGPU));
+	memset(m_rayStatsBuffer->getMappedMemory(), 0, sizeof(RayStatsGPU));
+
+	// depth d 의 ray 수 = 길이가 d + 1 이상인 path 수
+	uint64_t suffix = 0;
+	for (int32_t d = RAY_STATS_MAX_DEPTH - 1; d >= 0; d--) {
+		suffix += counters.pathLengths[d];
+		m_rayStats.depthRays[d] = suffix;
+	}
+	m_rayStats.shadowRays = counters.shadowRays;
+	m_rayStats.rouletteKills = counters.rouletteKills;
+	m_rayStats.missTerminations = counters.missTerminations;
+	m_rayStats.lightHits = counters.lightHits;
+
+	m_rayStats.frameRays = m_rayStats.shadowRays;
+	for (uint64_t rays : m_rayStats.depthRays) {
+		m_rayStats.frameRays += rays;
+	}
+	m_rayStats.accumulatedRays += m_rayStats.frameRays;
+	m_rayStats.raysPerSecond = traceSeconds > 0.0 ? m_rayStats.frameRays / traceSeconds : 0.0;
+}
+
+std::vector<float> Renderer::readAccumImage() {
+	VkDeviceSize size = static_cast<VkDeviceSize>(m_extent.width) * m_extent.height * 4 * sizeof(float);
+
+	VkBuffer stagingBuffer;
+	VkDeviceMemory stagingMemory;
+	VulkanUtil::createBuffer(m_context.get(), size, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingMemory);
 
-	// transfer image layout
 	auto cmd = VulkanUtil::beginSingleTimeCommands(m_context.get());
+	m_gpuProfiler->beginZone(cmd, "readback");
 
-	transferImageLayout(cmd, m_outputTexture.get(), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_NONE_KHR, VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR);
-	transferImageLayout(cmd, m_accum0Texture.get(), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_NONE_KHR, VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR);
-	transferImageLayout(cmd, m_accum1Texture.get(), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_NONE_KHR, VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR);
+	transferImageLayout(cmd, m_accumTexture.get(), VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+	VkBufferImageCopy region{};
+	region.bufferOffset = 0;
+	region.bufferRowLength = 0;
+	region.bufferImageHeight = 0;
+	region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	region.imageSubresource.mipLevel = 0;
+	region.imageSubresource.baseArrayLayer = 0;
+	region.imageSubresource.layerCount = 1;
+	region.imageOffset = {0, 0, 0};
+	region.imageExtent = {m_extent.width, m_extent.height, 1};
+	vkCmdCopyImageToBuffer(cmd, m_accumTexture->getImageBuffer()->getImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, stagingBuffer, 1, &region);
 
+	transferImageLayout(cmd, m_accumTexture.get(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_TRANSFER_READ_BIT, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR);
+
+	m_gpuProfiler->endZone(cmd);
 	VulkanUtil::endSingleTimeCommands(m_context.get(), cmd);
 
+	std::vector<float> pixels(static_cast<size_t>(m_extent.width) * m_extent.height * 4);
+	void* data;
+	vkMapMemory(m_context->getDevice(), stagingMemory, 0, size, 0, &data);
+	memcpy(pixels.data(), data, static_cast<size_t>(size));
+	vkUnmapMemory(m_context->getDevice(), stagingMemory);
+
+	vkDestroyBuffer(m_context->getDevice(), stagingBuffer, nullptr);
+	VulkanUtil::freeMemory(m_context.get(), stagingMemory);
+
+	// accum.a 에 sample 수가 누적되어 있음
+	for (size_t i = 0; i < pixels.size(); i += 4) {
+		float count = std::max(pixels[i + 3], 1.0f);
+		pixels[i + 0] /= count;
+		pixels[i + 1] /= count;
+		pixels[i + 2] /= count;
+		pixels[i + 3] = 1.0f;
+	}
+	return pixels;
+}
 
+void Renderer::saveImage(const std::string& path) {
+	CpuProfiler::Scope cpuZone("saveImage");
+	std::vector<float> pixels = readAccumImage();
+	ImageIO::writeImage(path, m_extent.width, m_extent.height, pixels);
+	std::cout << "Renderer::saveImage - " << path << std::endl;
 }
 
 void Renderer::update(float deltaTime) {
+	if (m_cameraPath) {
+		updateCameraPath(deltaTime);
+		return;
+	}
+
     bool rightPressed = glfwGetMouseButton(window, GLFW_MOUSE_BUTTON_RIGHT) == GLFW_PRESS;
 
 	CameraGPU prevCamera = m_camera;
@@ -386,11 +781,58 @@ void Renderer::update(float deltaTime) {
 }
 
 
+void Renderer::playCameraPath(const std::string& path, float fps, const std::string& outputPath) {
+	m_cameraPath = CameraPath::createCameraPath(path);
+	m_cameraPathFps = fps;
+	m_cameraPathOutput = outputPath;
+	m_cameraPathFrame = 0;
+	m_cameraPathFrames.clear();
+	m_cameraPathFrames.reserve(m_cameraPath->getFrameCount(fps));
+}
+
+void Renderer::updateCameraPath(float deltaTime) {
+	// deltaTime 은 이전 프레임의 길이
+	if (m_cameraPathFrame > 0) {
+		const GpuZoneStats* gpuTotal = m_gpuProfiler->findZoneStats("gpu total");
+		CameraPathFrame frame;
+		frame.frame = static_cast<int32_t>(m_cameraPathFrame) - 1;
+		frame.time = frame.frame / m_cameraPathFps;
+		frame.frameMs = deltaTime * 1000.0;
+		frame.gpuMs = gpuTotal ? gpuTotal->lastMs : 0.0;
+		frame.spp = m_options.currentSpp + 1;
+		m_cameraPathFrames.push_back(frame);
+	}
+
+	if (m_cameraPathFrame >= m_cameraPath->getFrameCount(m_cameraPathFps)) {
+		CameraPath::writeFrameTimings(m_cameraPathOutput, m_cameraPathFrames);
+		m_cameraPath.reset();
+		glfwSetWindowShouldClose(window, GLFW_TRUE);
+		return;
+	}
+
+	CameraKeyframe key = m_cameraPath->evaluate(m_cameraPathFrame / m_cameraPathFps);
+	m_cameraPathFrame++;
+
+	CameraGPU prevCamera = m_camera;
+	setCamera(key.position, CameraPath::getDirection(key.yaw, key.pitch), key.fovY);
+	if (prevCamera.camPos != m_camera.camPos || prevCamera.camDir != m_camera.camDir || prevCamera.fovY != m_camera.fovY) {
+		m_options.currentSpp = -1;
+	}
+}
+
 void Renderer::render(float deltaTime) {
-	vkWaitForFences(m_context->getDevice(), 1, &m_syncObjects->getInFlightFences()[currentFrame], VK_TRUE, UINT64_MAX);
+	CpuProfiler::Scope cpuZone("render");
+	{
+		CpuProfiler::Scope zone("wait fence");
+		vkWaitForFences(m_context->getDevice(), 1, &m_syncObjects->getInFlightFences()[currentFrame], VK_TRUE, UINT64_MAX);
+	}
 	uint32_t imageIndex;
-	VkResult result = vkAcquireNextImageKHR(m_context->getDevice(), m_swapChain->getSwapChain(), UINT64_MAX, 
-		m_syncObjects->getImageAvailableSemaphores()[currentFrame], VK_NULL_HANDLE, &imageIndex);
+	VkResult result;
+	{
+		CpuProfiler::Scope zone("acquire");
+		result = vkAcquireNextImageKHR(m_context->getDevice(), m_swapChain->getSwapChain(), UINT64_MAX,
+			m_syncObjects->getImageAvailableSemaphores()[currentFrame], VK_NULL_HANDLE, &imageIndex);
+	}
 
 	if (result == VK_ERROR_OUT_OF_DATE_KHR) {
 		std::cout << "Swapchain out of date!" << std::endl;
@@ -401,11 +843,18 @@ void Renderer::render(float deltaTime) {
 		throw std::runtime_error("failed to acquire swap chain image!");
 	}
 
-	ImVec2 newExtent = m_guiRenderer->getViewportSize();
-	if (abs((int)newExtent.x - (int)m_extent.width) >= 1 ||
-		abs((int)newExtent.y - (int)m_extent.height) >= 1) {
-		recreateViewport(newExtent);
+	updateViewportExtent(deltaTime);
+	m_gpuProfiler->beginFrame();
+	m_context->getMemoryTracker()->updateBudget();
+
+	// 이전 프레임 counter (fence 대기 이후라 stall 없음), 시간은 GPU trace 구간 기준
+	if (m_pipelineRayStats) {
+		const GpuZoneStats* traceZone = m_gpuProfiler->findZoneStats("trace");
+		double traceSeconds = (traceZone && traceZone->avgMs > 0.0f) ? traceZone->avgMs / 1000.0 : deltaTime;
+		collectRayStats(traceSeconds);
 	}
+	updateRayStatsPipeline();
+	collectAdaptiveStats();
 
 	vkResetFences(m_context->getDevice(), 1, &m_syncObjects->getInFlightFences()[currentFrame]);
 
@@ -426,32 +875,72 @@ void Renderer::render(float deltaTime) {
 		vkDeviceWaitIdle(m_context->getDevice());
 		uploadSceneToGPU();
 		m_instanceBuffer->updateStorageBuffer(&m_instanceGPU[0], sizeof(InstanceGPU) * m_instanceGPU.size());
+		if (!m_areaLightGPU.empty()) {
+			m_areaLightBuffer->updateStorageBuffer(&m_areaLightGPU[0], sizeof(AreaLightGPU) * m_areaLightGPU.size());
+		}
+		if (!m_emissiveTriangleGPU.empty()) {
+			m_emissiveTriangleBuffer->updateStorageBuffer(&m_emissiveTriangleGPU[0], sizeof(EmissiveTriangleGPU) * m_emissiveTriangleGPU.size());
+		}
 
-		m_tlas->recreate(m_blas, m_instanceGPU);
+		m_tlas->recreate(m_blas, m_instanceGPU, m_instanceTransforms);
 		m_set4DescSet.reset();
 		m_set4DescSet = DescriptorSet::createSet4DescSet(m_context.get(), m_set4Layout.get(), m_tlas->getHandle());
 		m_scene.isDirty = false;
 		m_options.currentSpp = -1;
 	}
 
-	m_cameraBuffer->updateUniformBuffer(&m_camera, sizeof(CameraGPU));
-	
+	// adaptive sampling 을 켜거나 끄면 moment / tile 오차를 실제 크기 또는 dummy 로 (누적은 GUI 에서 이미 reset)
+	if ((m_options.adaptive != 0) != m_adaptiveTargets) {
+		vkDeviceWaitIdle(m_context->getDevice());
+		createAdaptiveTargets();
+	}
+
 	m_options.frameCount++;
-	m_options.currentSpp++;
+	// adaptive sampling 이 이미 수렴했으면 sample index 유지 (tile slot 순환이 어긋나지 않도록)
+	if (!isAdaptiveConverged()) {
+		m_options.currentSpp++;
+	}
 
 	if (m_options.currentSpp >= m_options.maxSpp) {
 		m_options.currentSpp = m_options.maxSpp;
 	}
-	m_optionsBuffer->updateUniformBuffer(&m_options, sizeof(OptionsGPU));
-	m_areaLightBuffer->updateStorageBuffer(&m_areaLightGPU[0], sizeof(AreaLightGPU) * m_areaLightGPU.size());
 
+	// UBO 는 내용이 바뀔 때만 업로드 (이전 프레임의 fence 대기 이후라 안전)
+	if (m_options.maxSpp != m_uploadedOptions.maxSpp || m_options.lightCount != m_uploadedOptions.lightCount ||
+		m_options.adaptive != m_uploadedOptions.adaptive || m_options.adaptiveError != m_uploadedOptions.adaptiveError ||
+		m_options.adaptiveMinSpp != m_uploadedOptions.adaptiveMinSpp ||
+		m_options.emissiveTriangleCount != m_uploadedOptions.emissiveTriangleCount ||
+		m_options.areaLightSelectProb != m_uploadedOptions.areaLightSelectProb ||
+		m_options.environmentSelectProb != m_uploadedOptions.environmentSelectProb) {
+		m_optionsBuffer->updateUniformBuffer(&m_options, sizeof(OptionsGPU));
+		m_uploadedOptions = m_options;
+	}
 
-	recordPathTracingCommandBuffer();
-	transferImageLayout(cmd, m_outputTexture.get(), VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+	m_pushConstants.camPos = m_camera.camPos;
+	m_pushConstants.camDir = m_camera.camDir;
+	m_pushConstants.camUp = m_camera.camUp;
+	m_pushConstants.camRight = m_camera.camRight;
+	m_pushConstants.fovY = m_camera.fovY;
+	m_pushConstants.frameCount = m_options.frameCount;
+	m_pushConstants.currentSpp = m_options.currentSpp;
+
+
+	// 수렴했으면 dispatch 생략 (raygen 도 어차피 바로 return)
+	if (!isConverged()) {
+		recordPathTracingCommandBuffer();
+		recordAdaptiveReadback(cmd, m_options.currentSpp + 1);
+	}
+	{
+		GpuProfiler::Scope zone(m_gpuProfiler.get(), cmd, "layout");
+		transferImageLayout(cmd, m_outputTexture.get(), VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+	}
 
 	recordImGuiCommandBuffer(imageIndex, deltaTime);
 
-	transferImageLayout(cmd, m_outputTexture.get(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+	{
+		GpuProfiler::Scope zone(m_gpuProfiler.get(), cmd, "layout");
+		transferImageLayout(cmd, m_outputTexture.get(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+	}
 
 
 	if (vkEndCommandBuffer(cmd) != VK_SUCCESS) {
@@ -474,8 +963,11 @@ void Renderer::render(float deltaTime) {
 	submitInfo.signalSemaphoreCount = 1;
 	submitInfo.pSignalSemaphores = signalSemaphores;
 
-	if (vkQueueSubmit(m_context->getGraphicsQueue(), 1, &submitInfo, m_syncObjects->getInFlightFences()[currentFrame]) != VK_SUCCESS) {
-		throw std::runtime_error("failed to submit draw command buffer!");
+	{
+		CpuProfiler::Scope zone("submit");
+		if (vkQueueSubmit(m_context->getGraphicsQueue(), 1, &submitInfo, m_syncObjects->getInFlightFences()[currentFrame]) != VK_SUCCESS) {
+			throw std::runtime_error("failed to submit draw command buffer!");
+		}
 	}
 
 	VkPresentInfoKHR presentInfo{};
@@ -488,7 +980,10 @@ void Renderer::render(float deltaTime) {
 	presentInfo.pSwapchains = swapChains;
 	presentInfo.pImageIndices = &imageIndex;
 
-	result = vkQueuePresentKHR(m_context->getPresentQueue(), &presentInfo);
+	{
+		CpuProfiler::Scope zone("present");
+		result = vkQueuePresentKHR(m_context->getPresentQueue(), &presentInfo);
+	}
 
 	if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
 		recreateSwapChain();
@@ -501,6 +996,88 @@ void Renderer::render(float deltaTime) {
 	currentFrame = (currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
 }
 
+bool Renderer::isConverged() const {
+	return m_options.currentSpp >= m_options.maxSpp || isAdaptiveConverged();
+}
+
+bool Renderer::isAdaptiveConverged() const {
+	// 현재 누적에서 마지막으로 읽은 값일 때만 유효 (reset 이전 값은 sampleCount 가 달라서 무시됨)
+	return m_options.adaptive != 0 &&
+		m_adaptiveStats.sampleCount == m_options.currentSpp &&
+		m_adaptiveStats.sampleCount >= m_options.adaptiveMinSpp &&
+		m_adaptiveStats.activeTiles == 0;
+}
+
+uint32_t Renderer::getAdaptiveTileCount(VkExtent2D extent) {
+	uint32_t tilesX = (extent.width + ADAPTIVE_TILE_SIZE - 1) / ADAPTIVE_TILE_SIZE;
+	uint32_t tilesY = (extent.height + ADAPTIVE_TILE_SIZE - 1) / ADAPTIVE_TILE_SIZE;
+	return tilesX * tilesY;
+}
+
+void Renderer::recordAdaptiveReadback(VkCommandBuffer cmd, int32_t sampleCount) {
+	// sampleCount: 이 command buffer 가 끝났을 때의 누적 sample 수
+	if (!m_options.adaptive || sampleCount <= 0) {
+		return;
+	}
+
+	// 마지막으로 trace 한 sample 이 쓴 slot 만 복사 (slot 간격은 trace 크기 기준)
+	uint32_t tileCount = getAdaptiveTileCount(m_extent);
+	VkDeviceSize slotSize = static_cast<VkDeviceSize>(tileCount) * sizeof(uint32_t);
+
+	VkMemoryBarrier barrier{};
+	barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+	vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR, VK_PIPELINE_STAGE_TRANSFER_BIT,
+		0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+	VkBufferCopy region{};
+	region.srcOffset = (sampleCount % ADAPTIVE_TILE_SLOTS) * slotSize;
+	region.dstOffset = 0;
+	region.size = slotSize;
+	vkCmdCopyBuffer(cmd, m_tileErrorBuffer->getBuffer(), m_tileErrorReadback->getBuffer(), 1, &region);
+
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+	vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
+		0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+	m_adaptivePendingSamples = sampleCount;
+	m_adaptivePendingTiles = tileCount;
+}
+
+void Renderer::collectAdaptiveStats() {
+	// fence 대기 이후에만 호출
+	if (m_adaptivePendingSamples < 0) {
+		return;
+	}
+
+	const uint32_t* tileErrors = static_cast<const uint32_t*>(m_tileErrorReadback->getMappedMemory());
+	uint32_t activeTiles = 0;
+	float maxError = 0.0f;
+	for (uint32_t i = 0; i < m_adaptivePendingTiles; i++) {
+		if (tileErrors[i] == 0) {
+			continue;
+		}
+		float error;
+		memcpy(&error, &tileErrors[i], sizeof(float));
+		maxError = std::max(maxError, error);
+		activeTiles++;
+	}
+
+	m_adaptiveStats.sampleCount = m_adaptivePendingSamples;
+	m_adaptiveStats.activeTiles = activeTiles;
+	m_adaptiveStats.tileCount = m_adaptivePendingTiles;
+	m_adaptiveStats.maxError = maxError;
+	m_adaptivePendingSamples = -1;
+}
+
+bool Renderer::isIdle() const {
+	// 수렴했고, 반영 대기 중인 scene / viewport 변경이나 camera path 재생이 없을 때
+	return isConverged() && !m_scene.isDirty && !m_cameraPath &&
+		m_extent.width == m_requestedExtent.width && m_extent.height == m_requestedExtent.height;
+}
+
 void Renderer::recreateSwapChain() {
 	vkDeviceWaitIdle(m_context->getDevice());
 
@@ -523,47 +1100,135 @@ void Renderer::recreateSwapChain() {
 
 }
 
-void Renderer::recreateViewport(ImVec2 newExtent) {
-	vkDeviceWaitIdle(m_context->getDevice());
+VkExtent2D Renderer::getViewportBucket(VkExtent2D extent) {
+	auto roundUp = [](uint32_t v) {
+		v = std::max(v, 1u);
+		return ((v + VIEWPORT_BUCKET_SIZE - 1) / VIEWPORT_BUCKET_SIZE) * VIEWPORT_BUCKET_SIZE;
+	};
+	return { roundUp(extent.width), roundUp(extent.height) };
+}
 
-	m_options.currentSpp = -1;
-	if (newExtent.x <= 0 || newExtent.y <= 0) {
+void Renderer::updateViewportExtent(float deltaTime) {
+	ImVec2 viewportSize = m_guiRenderer->getViewportSize();
+	if (viewportSize.x < 1.0f || viewportSize.y < 1.0f) {
 		return;
 	}
 
-	m_extent.width = static_cast<uint32_t>(newExtent.x);
-	m_extent.height = static_cast<uint32_t>(newExtent.y);
+	VkExtent2D requested = { static_cast<uint32_t>(viewportSize.x), static_cast<uint32_t>(viewportSize.y) };
+	if (requested.width != m_requestedExtent.width || requested.height != m_requestedExtent.height) {
+		m_requestedExtent = requested;
+		m_resizeTimer = 0.0f;
+	}
+	else {
+		m_resizeTimer += deltaTime;
+	}
+
+	// 크기가 일정 시간 동안 안정된 뒤에만 재할당
+	// - 현재 bucket 보다 커졌을 때
+	// - 필요한 bucket 이 현재 할당의 절반 이하로 줄었을 때
+	if (m_resizeTimer >= VIEWPORT_RESIZE_DEBOUNCE) {
+		VkExtent2D bucket = getViewportBucket(m_requestedExtent);
+		bool grow = m_requestedExtent.width > m_allocExtent.width || m_requestedExtent.height > m_allocExtent.height;
+		bool shrink = static_cast<uint64_t>(bucket.width) * bucket.height * 2 <= static_cast<uint64_t>(m_allocExtent.width) * m_allocExtent.height;
+		if (grow || shrink) {
+			recreateViewport(bucket);
+		}
+	}
+
+	// 드래그 중에는 할당된 영역 안에서만 렌더링 (재할당 없음)
+	VkExtent2D renderExtent = {
+		std::min(m_requestedExtent.width, m_allocExtent.width),
+		std::min(m_requestedExtent.height, m_allocExtent.height)
+	};
+	if (renderExtent.width != m_extent.width || renderExtent.height != m_extent.height) {
+		m_extent = renderExtent;
+		m_options.currentSpp = -1;
+		m_guiRenderer->setViewportRegion(m_extent, m_allocExtent);
+	}
+}
+
+void Renderer::recreateViewport(VkExtent2D allocExtent) {
+	std::cout << "Renderer::recreateViewport " << allocExtent.width << " x " << allocExtent.height << std::endl;
+	vkDeviceWaitIdle(m_context->getDevice());
+
+	m_options.currentSpp = -1;
+	m_allocExtent = allocExtent;
+
+	// clear descriptor set
+	m_set5DescSet.reset();
 
 	// clear textures
 	m_outputTexture.reset();
-	m_accum0Texture.reset();
-	m_accum1Texture.reset();
+	m_accumTexture.reset();
+	m_momentTexture.reset();
+	m_tileErrorBuffer.reset();
+	m_tileErrorReadback.reset();
+	m_adaptivePendingSamples = -1;
 
-	// clear descriptor set
-	m_set5DescSets[0].reset();
-	m_set5DescSets[1].reset();
+	createViewportTargets();
+}
 
+void Renderer::createViewportTargets() {
 	// create textures
-	m_outputTexture = Texture::createAttachmentTexture(m_context.get(), m_extent.width, m_extent.height, VK_FORMAT_R32G32B32A32_SFLOAT, VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_ASPECT_COLOR_BIT);
-	m_accum0Texture = Texture::createAttachmentTexture(m_context.get(), m_extent.width, m_extent.height, VK_FORMAT_R32G32B32A32_SFLOAT, VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_ASPECT_COLOR_BIT);
-	m_accum1Texture = Texture::createAttachmentTexture(m_context.get(), m_extent.width, m_extent.height, VK_FORMAT_R32G32B32A32_SFLOAT, VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_ASPECT_COLOR_BIT);
+	m_outputTexture = Texture::createAttachmentTexture(m_context.get(), m_allocExtent.width, m_allocExtent.height, OUTPUT_IMAGE_FORMAT, VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_ASPECT_COLOR_BIT);
+	m_accumTexture = Texture::createAttachmentTexture(m_context.get(), m_allocExtent.width, m_allocExtent.height, ACCUM_IMAGE_FORMAT, VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT, VK_IMAGE_ASPECT_COLOR_BIT);
+
+	// 메모리 / 대역폭 비교 (이전: RGBA32F output + accum 2장 ping-pong), adaptive 면 moment 4 B/px 추가
+	uint64_t pixelCount = static_cast<uint64_t>(m_allocExtent.width) * m_allocExtent.height;
+	uint64_t outputBytes = (OUTPUT_IMAGE_FORMAT == VK_FORMAT_R8G8B8A8_UNORM) ? 4 : 8;
+	uint64_t legacyBytes = pixelCount * 16 * 3;
+	uint64_t currentBytes = pixelCount * (16 + outputBytes);
+	std::cout << "Renderer::createViewportTargets " << m_allocExtent.width << " x " << m_allocExtent.height
+		<< " memory " << currentBytes / (1024 * 1024) << " MB (ping-pong " << legacyBytes / (1024 * 1024) << " MB)"
+		<< ", traffic/frame " << (16 + 16 + outputBytes) << " B/px (ping-pong 48 B/px)" << std::endl;
 
-	// create descriptor set
-	m_set5DescSets[0] = DescriptorSet::createSet5DescSet(m_context.get(), m_set5Layout.get(), m_outputTexture.get(), m_accum0Texture.get(), m_accum1Texture.get());
-	m_set5DescSets[1] = DescriptorSet::createSet5DescSet(m_context.get(), m_set5Layout.get(), m_outputTexture.get(), m_accum1Texture.get(), m_accum0Texture.get());
+	// moment / tile 오차 + set5
+	createAdaptiveTargets();
 
 	// gui
-	m_guiRenderer->createViewPortDescriptorSet({m_outputTexture.get(), m_outputTexture.get()});
+	if (m_guiRenderer) {
+		m_guiRenderer->createViewPortDescriptorSet({m_outputTexture.get(), m_outputTexture.get()});
+		m_guiRenderer->setViewportRegion(m_extent, m_allocExtent);
+	}
 
 	auto cmd = VulkanUtil::beginSingleTimeCommands(m_context.get());
 
+	m_gpuProfiler->beginZone(cmd, "layout");
 	transferImageLayout(cmd, m_outputTexture.get(), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_NONE_KHR, VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR);
-	transferImageLayout(cmd, m_accum0Texture.get(), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_NONE_KHR, VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR);
-	transferImageLayout(cmd, m_accum1Texture.get(), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_NONE_KHR, VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR);
+	transferImageLayout(cmd, m_accumTexture.get(), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_NONE_KHR, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR);
+	m_gpuProfiler->endZone(cmd);
 
 	VulkanUtil::endSingleTimeCommands(m_context.get(), cmd);
 }
 
+// adaptive sampling 이 꺼져 있으면 moment / tile 오차는 1 x 1 dummy (shader 는 options.adaptive 일 때만 접근)
+// 켜고 끌 때마다 다시 만들고 set5 도 새로 씀
+void Renderer::createAdaptiveTargets() {
+	m_adaptiveTargets = m_options.adaptive != 0;
+	VkExtent2D extent = m_adaptiveTargets ? m_allocExtent : VkExtent2D{ 1, 1 };
+	m_momentTexture = Texture::createAttachmentTexture(m_context.get(), extent.width, extent.height, VK_FORMAT_R32_SFLOAT, VK_IMAGE_USAGE_STORAGE_BIT, VK_IMAGE_ASPECT_COLOR_BIT);
+
+	// tile 오차 (할당 크기 기준이라 sub-rect 는 항상 들어감)
+	uint32_t tileCount = getAdaptiveTileCount(extent);
+	m_tileErrorBuffer = StorageBuffer::createDeviceLocalStorageBuffer(m_context.get(), sizeof(uint32_t), static_cast<size_t>(tileCount) * ADAPTIVE_TILE_SLOTS);
+	m_tileErrorReadback = StorageBuffer::createStorageBuffer(m_context.get(), sizeof(uint32_t), tileCount);
+	m_adaptivePendingSamples = -1;
+
+	m_set5DescSet = DescriptorSet::createSet5DescSet(m_context.get(), m_set5Layout.get(), m_outputTexture.get(), m_accumTexture.get(), m_momentTexture.get(), m_tileErrorBuffer.get());
+
+	auto cmd = VulkanUtil::beginSingleTimeCommands(m_context.get());
+	transferImageLayout(cmd, m_momentTexture.get(), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL, VK_ACCESS_NONE_KHR, VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR);
+
+	vkCmdFillBuffer(cmd, m_tileErrorBuffer->getBuffer(), 0, VK_WHOLE_SIZE, 0);
+	VkMemoryBarrier fillBarrier{};
+	fillBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+	fillBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	fillBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+	vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_RAY_TRACING_SHADER_BIT_KHR,
+		0, 1, &fillBarrier, 0, nullptr, 0, nullptr);
+	VulkanUtil::endSingleTimeCommands(m_context.get(), cmd);
+}
+
 void Renderer::recordPathTracingCommandBuffer() {
 	VkCommandBuffer cmd = m_commandBuffers->getCommandBuffers()[currentFrame];
 
@@ -575,18 +1240,36 @@ void Renderer::recordPathTracingCommandBuffer() {
 		m_set2DescSet->getDescriptorSet(),
 		m_set3DescSet->getDescriptorSet(),
 		m_set4DescSet->getDescriptorSet(),
-		m_set5DescSets[m_options.frameCount % 2]->getDescriptorSet()
+		m_set5DescSet->getDescriptorSet()
 	};
 
 	vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR,
 		m_ptPipeline->getPipelineLayout(), 0, 6, sets, 0, nullptr);
 
+	// tile 렌더링이 아니면 trace 영역이 곧 전체 이미지
+	if (isTiled()) {
+		m_pushConstants.tileOffset = m_tileOffset;
+		m_pushConstants.imageSize = glm::uvec2(m_imageExtent.width, m_imageExtent.height);
+	}
+	else {
+		m_pushConstants.tileOffset = glm::uvec2(0);
+		m_pushConstants.imageSize = glm::uvec2(m_extent.width, m_extent.height);
+	}
+
+	vkCmdPushConstants(cmd, m_ptPipeline->getPipelineLayout(),
+		VK_SHADER_STAGE_RAYGEN_BIT_KHR | VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR | VK_SHADER_STAGE_MISS_BIT_KHR,
+		0, sizeof(FramePushConstants), &m_pushConstants);
+
+	GpuProfiler::Scope zone(m_gpuProfiler.get(), cmd, "trace");
+	VkStridedDeviceAddressRegionKHR raygenRegion = m_ptPipeline->getRaygenRegion();
+	VkStridedDeviceAddressRegionKHR missRegion = m_ptPipeline->getMissRegion();
+	VkStridedDeviceAddressRegionKHR hitRegion = m_ptPipeline->getHitRegion();
 	VkStridedDeviceAddressRegionKHR emptyRegion{};
 	g_vkCmdTraceRaysKHR(
 		cmd,
-		&m_ptPipeline->getRaygenRegion(),
-		&m_ptPipeline->getMissRegion(),
-		&m_ptPipeline->getHitRegion(),
+		&raygenRegion,
+		&missRegion,
+		&hitRegion,
 		&emptyRegion,
 		m_extent.width,
 		m_extent.height,
@@ -595,6 +1278,7 @@ void Renderer::recordPathTracingCommandBuffer() {
 
 
 void Renderer::recordImGuiCommandBuffer(uint32_t imageIndex, float deltaTime) {
+	CpuProfiler::Scope cpuZone("imgui");
 	VkCommandBuffer cmd = m_commandBuffers->getCommandBuffers()[currentFrame];
 	
 	VkRenderPassBeginInfo renderPassInfo{};
@@ -610,9 +1294,10 @@ void Renderer::recordImGuiCommandBuffer(uint32_t imageIndex, float deltaTime) {
 	renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
 	renderPassInfo.pClearValues = clearValues.data();
 
+	GpuProfiler::Scope zone(m_gpuProfiler.get(), cmd, "imgui");
 	vkCmdBeginRenderPass(cmd, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
 	m_guiRenderer->newFrame();
-	m_guiRenderer->render(cmd, m_options, m_scene, deltaTime);
+	m_guiRenderer->render(cmd, m_options, m_scene, m_gpuProfiler.get(), m_rayStats, m_adaptiveStats, deltaTime);
 	vkCmdEndRenderPass(cmd);
 }
 
@@ -651,7 +1336,9 @@ void Renderer::transferImageLayout( VkCommandBuffer cmd, Texture* texture, VkIma
 
 void Renderer::uploadSceneToGPU() {
 	m_instanceGPU.clear();
+	m_instanceTransforms.clear();
 	m_areaLightGPU.clear();
+	m_emissiveTriangleGPU.clear();
 
 	for (auto& object : m_scene.objects) {
 		glm::mat4 transform = glm::mat4(1.0f);
@@ -660,10 +1347,11 @@ void Renderer::uploadSceneToGPU() {
 		transform = glm::rotate(transform, glm::radians(object.rotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
 		transform = glm::rotate(transform, glm::radians(object.rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
 		transform = glm::scale(transform, object.scale);
+		glm::mat3x4 normalMatrix = glm::mat3x4(glm::transpose(glm::inverse(glm::mat3(transform))));
 
 		for (int i = 0; i < m_models[object.modelIndex].mesh.size(); i++) {
 			InstanceGPU instance;
-			instance.transform = transform;
+			instance.normalMatrix = normalMatrix;
 			instance.meshIndex = m_models[object.modelIndex].mesh[i];
 			instance.vertexAddress = m_meshes[instance.meshIndex]->getVertexBuffer()->getDeviceAddress();
 			instance.indexAddress = m_meshes[instance.meshIndex]->getIndexBuffer()->getDeviceAddress();
@@ -673,7 +1361,9 @@ void Renderer::uploadSceneToGPU() {
 			else {
 				instance.materialIndex = m_models[object.modelIndex].material[i];
 			}
+			appendEmissiveTriangles(instance, transform);
 			m_instanceGPU.push_back(instance);
+			m_instanceTransforms.push_back(transform);
 		}
 	}
 
@@ -701,9 +1391,8 @@ void Renderer::uploadSceneToGPU() {
 		areaLightGPU.p2 = toWorld(glm::vec3( 0.5f,  0.5f, 0.0f));
 		areaLightGPU.p3 = toWorld(glm::vec3(-0.5f,  0.5f, 0.0f));
 		
-		instance.transform = transform;
-
 		glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(transform)));
+		instance.normalMatrix = glm::mat3x4(normalMatrix);
 		areaLightGPU.normal = glm::normalize(normalMatrix * glm::vec3(0.0f, 0.0f, 1.0f));
 
 
@@ -716,7 +1405,190 @@ void Renderer::uploadSceneToGPU() {
 
 
 		m_instanceGPU.push_back(instance);
+		m_instanceTransforms.push_back(transform);
 	}
 
 	m_options.lightCount = m_scene.areaLights.size();
+	m_options.emissiveTriangleCount = static_cast<int>(m_emissiveTriangleGPU.size());
+	buildLightAliasTable();
+}
+
+// emissive material 을 쓰는 instance 의 triangle 을 world space 로 모음 (NEE 용)
+// 순서는 index buffer 와 같아서 hit 시 emissiveTriangleOffset + gl_PrimitiveID 로 찾음
+void Renderer::appendEmissiveTriangles(InstanceGPU& instance, const glm::mat4& transform) {
+	if (instance.materialIndex < 0) {
+		return;
+	}
+	const MaterialGPU& material = m_materials[instance.materialIndex];
+	if (glm::dot(material.emissiveFactor, glm::vec3(0.2126f, 0.7152f, 0.0722f)) <= 0.0f) {
+		return;
+	}
+
+	const std::vector<Vertex>& vertices = m_meshes[instance.meshIndex]->getVertices();
+	const std::vector<uint32_t>& indices = m_meshes[instance.meshIndex]->getIndices();
+	uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+	if (m_emissiveTriangleGPU.size() + triangleCount > MAX_EMISSIVE_TRIANGLE_COUNT) {
+		std::cout << "Renderer::appendEmissiveTriangles - over " << MAX_EMISSIVE_TRIANGLE_COUNT << " triangles, mesh " << instance.meshIndex << " skipped" << std::endl;
+		return;
+	}
+
+	instance.emissiveTriangleOffset = static_cast<int>(m_emissiveTriangleGPU.size());
+	for (uint32_t t = 0; t < triangleCount; t++) {
+		const Vertex& v0 = vertices[indices[t * 3 + 0]];
+		const Vertex& v1 = vertices[indices[t * 3 + 1]];
+		const Vertex& v2 = vertices[indices[t * 3 + 2]];
+
+		EmissiveTriangleGPU tri;
+		tri.p0 = glm::vec3(transform * glm::vec4(v0.pos, 1.0f));
+		tri.p1 = glm::vec3(transform * glm::vec4(v1.pos, 1.0f));
+		tri.p2 = glm::vec3(transform * glm::vec4(v2.pos, 1.0f));
+		tri.uv0 = v0.texCoord;
+		tri.uv1 = v1.texCoord;
+		tri.uv2 = v2.texCoord;
+		tri.area = 0.5f * glm::length(glm::cross(tri.p1 - tri.p0, tri.p2 - tri.p0));
+		tri.materialIndex = instance.materialIndex;
+		m_emissiveTriangleGPU.push_back(tri);
+	}
+}
+
+// 선택 확률을 power 에 비례하게: Vose alias table
+// shader 는 slot 하나를 균등하게 고르고 aliasProb 로 그 slot / alias 중 하나를 선택 (O(1))
+template <typename T>
+static void buildAliasTable(std::vector<T>& entries, std::vector<double>& power) {
+	uint32_t count = static_cast<uint32_t>(entries.size());
+	double totalPower = 0.0;
+	for (double p : power) {
+		totalPower += p;
+	}
+	if (totalPower <= 0.0) {
+		std::fill(power.begin(), power.end(), 1.0);
+		totalPower = count;
+	}
+
+	std::vector<double> scaled(count);
+	std::vector<uint32_t> small;
+	std::vector<uint32_t> large;
+	for (uint32_t i = 0; i < count; i++) {
+		entries[i].selectPdf = static_cast<float>(power[i] / totalPower);
+		scaled[i] = power[i] * count / totalPower;
+		(scaled[i] < 1.0 ? small : large).push_back(i);
+	}
+	while (!small.empty() && !large.empty()) {
+		uint32_t s = small.back();
+		small.pop_back();
+		uint32_t l = large.back();
+		large.pop_back();
+
+		entries[s].aliasProb = static_cast<float>(scaled[s]);
+		entries[s].aliasIndex = static_cast<int32_t>(l);
+		scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+		(scaled[l] < 1.0 ? small : large).push_back(l);
+	}
+	// 남은 slot 은 (반올림 오차 포함) 항상 자기 자신
+	for (uint32_t i : large) {
+		entries[i].aliasProb = 1.0f;
+		entries[i].aliasIndex = static_cast<int32_t>(i);
+	}
+	for (uint32_t i : small) {
+		entries[i].aliasProb = 1.0f;
+		entries[i].aliasIndex = static_cast<int32_t>(i);
+	}
+}
+
+// quad light (intensity x area x luminance) 와 emissive triangle (area x luminance(emissiveFactor)) 각각의 alias table
+// 두 집합 사이는 전체 power 비율 areaLightSelectProb 로 선택
+void Renderer::buildLightAliasTable() {
+	const glm::vec3 lumWeights(0.2126f, 0.7152f, 0.0722f);
+
+	double quadPower = 0.0;
+	if (!m_areaLightGPU.empty()) {
+		std::vector<double> power(m_areaLightGPU.size());
+		for (size_t i = 0; i < m_areaLightGPU.size(); i++) {
+			const AreaLightGPU& light = m_areaLightGPU[i];
+			double luminance = glm::dot(light.color, lumWeights);
+			power[i] = std::max(static_cast<double>(light.intensity) * light.area * luminance, 0.0);
+			quadPower += power[i];
+		}
+		buildAliasTable(m_areaLightGPU, power);
+	}
+
+	double triPower = 0.0;
+	if (!m_emissiveTriangleGPU.empty()) {
+		std::vector<double> power(m_emissiveTriangleGPU.size());
+		for (size_t i = 0; i < m_emissiveTriangleGPU.size(); i++) {
+			const EmissiveTriangleGPU& tri = m_emissiveTriangleGPU[i];
+			double luminance = glm::dot(m_materials[tri.materialIndex].emissiveFactor, lumWeights);
+			power[i] = std::max(static_cast<double>(tri.area) * luminance, 0.0);
+			triPower += power[i];
+		}
+		buildAliasTable(m_emissiveTriangleGPU, power);
+	}
+
+	if (m_emissiveTriangleGPU.empty()) {
+		m_options.areaLightSelectProb = 1.0f;
+	}
+	else if (m_areaLightGPU.empty()) {
+		m_options.areaLightSelectProb = 0.0f;
+	}
+	else {
+		m_options.areaLightSelectProb = static_cast<float>(quadPower / std::max(quadPower + triPower, 1e-12));
+	}
+
+	// environment 는 power 를 다른 light 와 비교하기 어려워 (scene 크기에 의존) 고정 비율로 선택
+	if (m_options.environmentTexIndex < 0) {
+		m_options.environmentSelectProb = 0.0f;
+	}
+	else if (m_areaLightGPU.empty() && m_emissiveTriangleGPU.empty()) {
+		m_options.environmentSelectProb = 1.0f;
+	}
+	else {
+		m_options.environmentSelectProb = ENVIRONMENT_SELECT_PROB;
+	}
+}
+
+// equirectangular HDR environment: texture 는 bindless textures[] 에 추가하고,
+// cell 마다 평균 luminance x sin(theta) 비례 alias table 을 만들어 NEE 에서 importance sampling
+// (u = atan(d.z, d.x) / 2pi + 0.5, v = acos(d.y) / pi, shader 의 equirect 함수와 같아야 함)
+void Renderer::loadEnvironment(const std::string& path, float intensity) {
+	CpuProfiler::Scope cpuZone("loadEnvironment");
+	uint32_t width = 0;
+	uint32_t height = 0;
+	std::vector<float> rgba = ImageIO::readImage(path, width, height);
+	if (m_textures.size() >= MAX_TEXTURE_COUNT) {
+		throw std::runtime_error("failed to load environment map: too many textures!");
+	}
+	m_textures.push_back(Texture::createHDRTextureFromMemory(m_context.get(), rgba, width, height));
+	m_options.environmentTexIndex = static_cast<int>(m_textures.size()) - 1;
+	m_options.environmentIntensity = intensity;
+
+	// 분포는 가로 ENVIRONMENT_DISTRIBUTION_MAX_WIDTH 이하로 줄임 (cell 은 uv 공간에서 균등, pixel 은 box 평균)
+	uint32_t distWidth = std::min(width, ENVIRONMENT_DISTRIBUTION_MAX_WIDTH);
+	uint32_t distHeight = std::clamp<uint32_t>(static_cast<uint32_t>(std::lround(static_cast<double>(height) * distWidth / width)), 1, height);
+	m_options.environmentDistWidth = static_cast<int>(distWidth);
+	m_options.environmentDistHeight = static_cast<int>(distHeight);
+
+	const glm::vec3 lumWeights(0.2126f, 0.7152f, 0.0722f);
+	m_environmentCells.assign(static_cast<size_t>(distWidth) * distHeight, EnvironmentCellGPU());
+	std::vector<double> power(m_environmentCells.size());
+	for (uint32_t cy = 0; cy < distHeight; cy++) {
+		uint32_t y0 = cy * height / distHeight;
+		uint32_t y1 = std::max((cy + 1) * height / distHeight, y0 + 1);
+		double sinTheta = std::sin(glm::pi<double>() * (cy + 0.5) / distHeight);
+		for (uint32_t cx = 0; cx < distWidth; cx++) {
+			uint32_t x0 = cx * width / distWidth;
+			uint32_t x1 = std::max((cx + 1) * width / distWidth, x0 + 1);
+			double sum = 0.0;
+			for (uint32_t y = y0; y < y1; y++) {
+				for (uint32_t x = x0; x < x1; x++) {
+					const float* pixel = &rgba[(static_cast<size_t>(y) * width + x) * 4];
+					sum += std::max(glm::dot(glm::vec3(pixel[0], pixel[1], pixel[2]), lumWeights), 0.0f);
+				}
+			}
+			power[static_cast<size_t>(cy) * distWidth + cx] = sum / ((y1 - y0) * (x1 - x0)) * sinTheta;
+		}
+	}
+	buildAliasTable(m_environmentCells, power);
+
+	std::cout << "Renderer::loadEnvironment - " << path << ", " << width << " x " << height
+		<< ", distribution " << distWidth << " x " << distHeight << std::endl;
 }
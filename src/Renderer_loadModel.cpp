@@ -208,11 +208,13 @@ void Renderer::printAllModelInfo() {
 void Renderer::printAllInstanceInfo() {
 	std::cout << "m_instanceGPU.size() : " << m_instanceGPU.size() << std::endl;
 
-	for (auto& instance : m_instanceGPU) {
-		std::cout << "instance.transform : " << instance.transform[0][0] << " " << instance.transform[0][1] << " " << instance.transform[0][2] << " " << instance.transform[0][3] << std::endl;
-		std::cout << "instance.transform : " << instance.transform[1][0] << " " << instance.transform[1][1] << " " << instance.transform[1][2] << " " << instance.transform[1][3] << std::endl;
-		std::cout << "instance.transform : " << instance.transform[2][0] << " " << instance.transform[2][1] << " " << instance.transform[2][2] << " " << instance.transform[2][3] << std::endl;
-		std::cout << "instance.transform : " << instance.transform[3][0] << " " << instance.transform[3][1] << " " << instance.transform[3][2] << " " << instance.transform[3][3] << std::endl;
+	for (size_t i = 0; i < m_instanceGPU.size(); i++) {
+		const InstanceGPU& instance = m_instanceGPU[i];
+		const glm::mat4& transform = m_instanceTransforms[i];
+		std::cout << "instance.transform : " << transform[0][0] << " " << transform[0][1] << " " << transform[0][2] << " " << transform[0][3] << std::endl;
+		std::cout << "instance.transform : " << transform[1][0] << " " << transform[1][1] << " " << transform[1][2] << " " << transform[1][3] << std::endl;
+		std::cout << "instance.transform : " << transform[2][0] << " " << transform[2][1] << " " << transform[2][2] << " " << transform[2][3] << std::endl;
+		std::cout << "instance.transform : " << transform[3][0] << " " << transform[3][1] << " " << transform[3][2] << " " << transform[3][3] << std::endl;
 
 		std::cout << "instance.vertexAddress : " << instance.vertexAddress << std::endl;
 		std::cout << "instance.indexAddress : " << instance.indexAddress << std::endl;
@@ -242,6 +244,7 @@ void Renderer::printAllAreaLightInfo() {
 
 
 void Renderer::loadTinyGLTFModel(const std::string& path) {
+	CpuProfiler::Scope cpuZone("load " + std::filesystem::path(path).filename().string());
     tinygltf::TinyGLTF loader;
 	tinygltf::Model model;
 	std::string err, warn;
@@ -0,0 +1,39 @@
+#include "include/Sampler.h"
+
+// Joe & Kuo (new-joe-kuo-6.21201) 의 앞 SOBOL_DIMENSIONS 차원 (0 번은 van der Corput)
+struct SobolPolynomial {
+	uint32_t degree;
+	uint32_t coefficients;
+	uint32_t initial[3];
+};
+
+static const SobolPolynomial SOBOL_POLYNOMIALS[SOBOL_DIMENSIONS - 1] = {
+	{ 1, 0, { 1, 0, 0 } },
+	{ 2, 1, { 1, 3, 0 } },
+	{ 3, 1, { 1, 3, 1 } },
+};
+
+std::vector<uint32_t> Sampler::buildSobolDirections() {
+	std::vector<uint32_t> directions(SOBOL_DIMENSIONS * SOBOL_BITS);
+
+	for (uint32_t bit = 0; bit < SOBOL_BITS; bit++) {
+		directions[bit] = 1u << (31 - bit);
+	}
+
+	for (uint32_t dim = 1; dim < SOBOL_DIMENSIONS; dim++) {
+		const SobolPolynomial& poly = SOBOL_POLYNOMIALS[dim - 1];
+		uint32_t* v = &directions[dim * SOBOL_BITS];
+		uint32_t s = poly.degree;
+
+		for (uint32_t bit = 0; bit < std::min(s, SOBOL_BITS); bit++) {
+			v[bit] = poly.initial[bit] << (31 - bit);
+		}
+		for (uint32_t bit = s; bit < SOBOL_BITS; bit++) {
+			v[bit] = v[bit - s] ^ (v[bit - s] >> s);
+			for (uint32_t k = 1; k < s; k++) {
+				v[bit] ^= ((poly.coefficients >> (s - 1 - k)) & 1u) * v[bit - k];
+			}
+		}
+	}
+	return directions;
+}
@@ -238,3 +238,31 @@ void Texture::initTextureFromMemory(VulkanContext* context, const tinygltf::Imag
 		throw std::runtime_error("failed to create image sampler from memory!");
 	}
 }
+
+std::unique_ptr<Texture> Texture::createHDRTextureFromMemory(VulkanContext* context, const std::vector<float>& rgba, uint32_t width, uint32_t height) {
+	std::unique_ptr<Texture> texture = std::unique_ptr<Texture>(new Texture());
+	texture->initHDRTextureFromMemory(context, rgba, width, height);
+	return texture;
+}
+
+// equirectangular environment map (rgba32f): 가로는 wrap, 세로 (극) 는 clamp
+void Texture::initHDRTextureFromMemory(VulkanContext* context, const std::vector<float>& rgba, uint32_t width, uint32_t height) {
+	this->context = context;
+
+	VkFormat format = VK_FORMAT_R32G32B32A32_SFLOAT;
+	m_imageBuffer = ImageBuffer::createHDRImageBufferFromMemory(context, rgba.data(), width, height);
+	m_imageView = VulkanUtil::createImageView(
+		context,
+		m_imageBuffer->getImage(),
+		format,
+		VK_IMAGE_ASPECT_COLOR_BIT,
+		m_imageBuffer->getMipLevels()
+	);
+	m_format = format;
+
+	VkSamplerCreateInfo samplerInfo = createDefaultSamplerInfo();
+	samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	if (vkCreateSampler(context->getDevice(), &samplerInfo, nullptr, &m_sampler) != VK_SUCCESS) {
+		throw std::runtime_error("failed to create hdr image sampler!");
+	}
+}
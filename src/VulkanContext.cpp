@@ -1,4 +1,5 @@
 ﻿#include "include/VulkanContext.h"
+#include "include/MemoryTracker.h"
 
 std::unique_ptr<VulkanContext> VulkanContext::createVulkanContext(GLFWwindow* window) {
 	std::unique_ptr<VulkanContext> context = std::unique_ptr<VulkanContext>(new VulkanContext());
@@ -6,6 +7,14 @@ std::unique_ptr<VulkanContext> VulkanContext::createVulkanContext(GLFWwindow* wi
 	return context;
 }
 
+// surface / swapchain 없이 ray tracing 만 사용
+std::unique_ptr<VulkanContext> VulkanContext::createHeadlessVulkanContext() {
+	std::unique_ptr<VulkanContext> context = std::unique_ptr<VulkanContext>(new VulkanContext());
+	context->m_headless = true;
+	context->init(nullptr);
+	return context;
+}
+
 VulkanContext::~VulkanContext() {
 	cleanup();
 }
@@ -13,25 +22,35 @@ VulkanContext::~VulkanContext() {
 void VulkanContext::init(GLFWwindow* window) {
 	std::cout << "VulkanContext::init" << std::endl;
 	createInstance();
+	loadDebugUtilsFunctions();
 	setupDebugMessenger();
-	createSurface(window);
+	if (!m_headless) {
+		createSurface(window);
+	}
 	pickPhysicalDevice();
 	createLogicalDevice();
+	m_memoryTracker = MemoryTracker::createMemoryTracker(m_physicalDevice, m_memoryBudget);
 	loadRayTracingFunctions();
 	createCommandPool();
 	createDescriptorPool();
+	createPipelineCache();
 }
 
 
 void VulkanContext::cleanup() {
 	std::cout << "VulkanContext::cleanup" << std::endl;
+	savePipelineCache();
+	vkDestroyPipelineCache(m_device, m_pipelineCache, nullptr);
 	vkDestroyDescriptorPool(m_device, m_descriptorPool, nullptr);
     vkDestroyCommandPool(m_device, m_commandPool, nullptr);
     vkDestroyDevice(m_device, nullptr);
+	m_memoryTracker.reset();
     if (enableValidationLayers) {
         DestroyDebugUtilsMessengerEXT(m_instance, m_debugMessenger, nullptr);
     }
-    vkDestroySurfaceKHR(m_instance, m_surface, nullptr);
+    if (m_surface != VK_NULL_HANDLE) {
+        vkDestroySurfaceKHR(m_instance, m_surface, nullptr);
+    }
     vkDestroyInstance(m_instance, nullptr);
 }
 
@@ -108,17 +127,36 @@ void VulkanContext::populateDebugMessengerCreateInfo(VkDebugUtilsMessengerCreate
 }
 
 std::vector<const char*> VulkanContext::getRequiredExtensions() {
-	uint32_t glfwExtensionCount = 0;
-	const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
-	std::vector<const char*> extensions(glfwExtensions, glfwExtensions + glfwExtensionCount);
+	std::vector<const char*> extensions;
+	if (!m_headless) {
+		uint32_t glfwExtensionCount = 0;
+		const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+		extensions.assign(glfwExtensions, glfwExtensions + glfwExtensionCount);
+	}
 
-	if (enableValidationLayers) {
+	// validation 이 없어도 RenderDoc / Nsight 에서 command label 을 보도록 켬
+	m_debugUtils = enableValidationLayers || checkInstanceExtensionSupport(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+	if (m_debugUtils) {
 		extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
 	}
 
 	return extensions;
 }
 
+bool VulkanContext::checkInstanceExtensionSupport(const char* extensionName) {
+	uint32_t extensionCount = 0;
+	vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, nullptr);
+	std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+	vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, availableExtensions.data());
+
+	for (const auto& extension : availableExtensions) {
+		if (strcmp(extensionName, extension.extensionName) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
 void VulkanContext::setupDebugMessenger() {
 	if (!enableValidationLayers) return;
 
@@ -168,7 +206,10 @@ bool VulkanContext::isDeviceSuitable(VkPhysicalDevice device) {
 	bool extensionsSupported = checkDeviceExtensionSupport(device);
 	bool swapChainAdequate = false;
 
-	if (extensionsSupported) {
+	if (m_headless) {
+		swapChainAdequate = true;
+	}
+	else if (extensionsSupported) {
 		SwapChainSupportDetails swapChainSupport = querySwapChainSupport(device);
 		swapChainAdequate = !swapChainSupport.formats.empty() && !swapChainSupport.presentModes.empty();
 	}
@@ -227,7 +268,12 @@ QueueFamilyIndices VulkanContext::findQueueFamilies(VkPhysicalDevice device) {
 		}
 
 		VkBool32 presentSupport = false;
-		vkGetPhysicalDeviceSurfaceSupportKHR(device, i, m_surface, &presentSupport);
+		if (m_headless) {
+			presentSupport = (queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0;
+		}
+		else {
+			vkGetPhysicalDeviceSurfaceSupportKHR(device, i, m_surface, &presentSupport);
+		}
 
 		if (presentSupport) {
 			indices.presentFamily = i;
@@ -249,7 +295,8 @@ bool VulkanContext::checkDeviceExtensionSupport(VkPhysicalDevice device) {
 	std::vector<VkExtensionProperties> availableExtensions(extensionCount);
 	vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, availableExtensions.data());
 
-	std::set<std::string> requiredExtensions(deviceExtensions.begin(), deviceExtensions.end());
+	std::vector<const char*> extensions = getDeviceExtensions();
+	std::set<std::string> requiredExtensions(extensions.begin(), extensions.end());
 	for (const auto& extension : availableExtensions) {
 		requiredExtensions.erase(extension.extensionName);
 	}
@@ -264,6 +311,35 @@ bool VulkanContext::checkDeviceExtensionSupport(VkPhysicalDevice device) {
 	return requiredExtensions.empty();
 }
 
+bool VulkanContext::checkOptionalDeviceExtensionSupport(VkPhysicalDevice device, const char* extensionName) {
+	uint32_t extensionCount;
+	vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, nullptr);
+	std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+	vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, availableExtensions.data());
+
+	for (const auto& extension : availableExtensions) {
+		if (strcmp(extensionName, extension.extensionName) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+std::vector<const char*> VulkanContext::getDeviceExtensions() {
+	std::vector<const char*> extensions;
+	for (const char* extension : deviceExtensions) {
+		if (m_headless && strcmp(extension, VK_KHR_SWAPCHAIN_EXTENSION_NAME) == 0) {
+			continue;
+		}
+		extensions.push_back(extension);
+	}
+	// 없으면 MemoryTracker 가 heap size 를 budget 으로 사용
+	if (m_memoryBudget) {
+		extensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+	}
+	return extensions;
+}
+
 SwapChainSupportDetails VulkanContext::querySwapChainSupport(VkPhysicalDevice device) {
 	SwapChainSupportDetails details;
 
@@ -303,6 +379,8 @@ void VulkanContext::createLogicalDevice() {
 		queueCreateInfos.push_back(queueCreateInfo);
 	}
 
+	m_memoryBudget = checkOptionalDeviceExtensionSupport(m_physicalDevice, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+
 	VkPhysicalDeviceFeatures deviceFeatures{};
 	deviceFeatures.samplerAnisotropy = VK_TRUE;
 	deviceFeatures.sampleRateShading = VK_TRUE;
@@ -331,6 +409,7 @@ void VulkanContext::createLogicalDevice() {
 	features12.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
 	features12.bufferDeviceAddress = VK_TRUE;
 	features12.scalarBlockLayout = VK_TRUE;
+	features12.hostQueryReset = VK_TRUE; // GpuProfiler
 
 	atomicFloatFeatures.pNext = &features12;
 	features12.pNext = &rayTracingPipelineFeatures;
@@ -346,8 +425,9 @@ void VulkanContext::createLogicalDevice() {
 	createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
 	createInfo.pQueueCreateInfos = queueCreateInfos.data();
 	createInfo.pNext = &features2;
-	createInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
-	createInfo.ppEnabledExtensionNames = deviceExtensions.data();
+	std::vector<const char*> extensions = getDeviceExtensions();
+	createInfo.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+	createInfo.ppEnabledExtensionNames = extensions.data();
 
 	if (enableValidationLayers) {
 		createInfo.enabledLayerCount = static_cast<uint32_t>(validationLayers.size());
@@ -411,6 +491,99 @@ void VulkanContext::createDescriptorPool() {
 	}
 }
 
+// 파일 앞에 붙이는 헤더. 드라이버가 바뀌면 캐시를 버린다.
+struct PipelineCacheFileHeader {
+	uint32_t magic = 0x50434348; // "PCCH"
+	uint32_t vendorID = 0;
+	uint32_t deviceID = 0;
+	uint32_t driverVersion = 0;
+	uint8_t pipelineCacheUUID[VK_UUID_SIZE] = {};
+	uint64_t dataSize = 0;
+};
+
+void VulkanContext::createPipelineCache() {
+	VkPhysicalDeviceProperties props;
+	vkGetPhysicalDeviceProperties(m_physicalDevice, &props);
+
+	std::vector<char> initialData;
+	std::ifstream file(PIPELINE_CACHE_PATH, std::ios::binary | std::ios::ate);
+	if (file.is_open()) {
+		size_t fileSize = static_cast<size_t>(file.tellg());
+		file.seekg(0);
+
+		PipelineCacheFileHeader header;
+		if (fileSize >= sizeof(header)) {
+			file.read(reinterpret_cast<char*>(&header), sizeof(header));
+			bool valid = header.magic == PipelineCacheFileHeader().magic &&
+				header.vendorID == props.vendorID &&
+				header.deviceID == props.deviceID &&
+				header.driverVersion == props.driverVersion &&
+				memcmp(header.pipelineCacheUUID, props.pipelineCacheUUID, VK_UUID_SIZE) == 0 &&
+				header.dataSize == fileSize - sizeof(header);
+			if (valid) {
+				initialData.resize(header.dataSize);
+				file.read(initialData.data(), header.dataSize);
+			}
+			else {
+				std::cout << "VulkanContext::createPipelineCache - cache mismatch (device / driver changed), ignored" << std::endl;
+			}
+		}
+	}
+
+	VkPipelineCacheCreateInfo cacheInfo{};
+	cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+	cacheInfo.initialDataSize = initialData.size();
+	cacheInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+
+	if (vkCreatePipelineCache(m_device, &cacheInfo, nullptr, &m_pipelineCache) != VK_SUCCESS) {
+		// 캐시 데이터가 깨졌으면 빈 캐시로 다시 시도
+		cacheInfo.initialDataSize = 0;
+		cacheInfo.pInitialData = nullptr;
+		initialData.clear();
+		if (vkCreatePipelineCache(m_device, &cacheInfo, nullptr, &m_pipelineCache) != VK_SUCCESS) {
+			throw std::runtime_error("failed to create pipeline cache!");
+		}
+	}
+
+	m_pipelineCacheWarm = !initialData.empty();
+	std::cout << "VulkanContext::createPipelineCache - " << (m_pipelineCacheWarm ? "warm" : "cold")
+		<< " (" << initialData.size() << " bytes)" << std::endl;
+}
+
+void VulkanContext::savePipelineCache() {
+	if (m_pipelineCache == VK_NULL_HANDLE) {
+		return;
+	}
+
+	size_t dataSize = 0;
+	if (vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0) {
+		return;
+	}
+	std::vector<char> data(dataSize);
+	if (vkGetPipelineCacheData(m_device, m_pipelineCache, &dataSize, data.data()) != VK_SUCCESS) {
+		return;
+	}
+
+	VkPhysicalDeviceProperties props;
+	vkGetPhysicalDeviceProperties(m_physicalDevice, &props);
+
+	PipelineCacheFileHeader header;
+	header.vendorID = props.vendorID;
+	header.deviceID = props.deviceID;
+	header.driverVersion = props.driverVersion;
+	memcpy(header.pipelineCacheUUID, props.pipelineCacheUUID, VK_UUID_SIZE);
+	header.dataSize = dataSize;
+
+	std::ofstream file(PIPELINE_CACHE_PATH, std::ios::binary | std::ios::trunc);
+	if (!file.is_open()) {
+		std::cout << "VulkanContext::savePipelineCache - failed to open " << PIPELINE_CACHE_PATH << std::endl;
+		return;
+	}
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(data.data(), dataSize);
+	std::cout << "VulkanContext::savePipelineCache - " << dataSize << " bytes" << std::endl;
+}
+
 PFN_vkCreateAccelerationStructureKHR g_vkCreateAccelerationStructureKHR = nullptr;
 PFN_vkDestroyAccelerationStructureKHR g_vkDestroyAccelerationStructureKHR = nullptr;
 PFN_vkGetAccelerationStructureBuildSizesKHR g_vkGetAccelerationStructureBuildSizesKHR = nullptr;
@@ -421,6 +594,20 @@ PFN_vkCreateRayTracingPipelinesKHR g_vkCreateRayTracingPipelinesKHR = nullptr;
 PFN_vkGetRayTracingShaderGroupHandlesKHR g_vkGetRayTracingShaderGroupHandlesKHR = nullptr;
 PFN_vkCmdTraceRaysKHR g_vkCmdTraceRaysKHR = nullptr;
 
+PFN_vkCmdBeginDebugUtilsLabelEXT g_vkCmdBeginDebugUtilsLabelEXT = nullptr;
+PFN_vkCmdEndDebugUtilsLabelEXT g_vkCmdEndDebugUtilsLabelEXT = nullptr;
+
+void VulkanContext::loadDebugUtilsFunctions() {
+	if (!m_debugUtils) {
+		return;
+	}
+	g_vkCmdBeginDebugUtilsLabelEXT = reinterpret_cast<PFN_vkCmdBeginDebugUtilsLabelEXT>(
+		vkGetInstanceProcAddr(m_instance, "vkCmdBeginDebugUtilsLabelEXT"));
+
+	g_vkCmdEndDebugUtilsLabelEXT = reinterpret_cast<PFN_vkCmdEndDebugUtilsLabelEXT>(
+		vkGetInstanceProcAddr(m_instance, "vkCmdEndDebugUtilsLabelEXT"));
+}
+
 void VulkanContext::loadRayTracingFunctions() {
 	// Acceleration Structure
 	g_vkCreateAccelerationStructureKHR = reinterpret_cast<PFN_vkCreateAccelerationStructureKHR>(
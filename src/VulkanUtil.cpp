@@ -16,7 +16,7 @@ uint32_t VulkanUtil::findMemoryType(VulkanContext* context, uint32_t typeFilter,
 }
 
 void VulkanUtil::createImage(VulkanContext* context, uint32_t width, uint32_t height, uint32_t mipLevels, VkSampleCountFlagBits numSamples,
-	VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory, bool isCubeMap) {
+	VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory, bool isCubeMap, MemoryCategory category) {
 
 	VkImageCreateInfo imageInfo{};
 	imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -48,7 +48,7 @@ void VulkanUtil::createImage(VulkanContext* context, uint32_t width, uint32_t he
 	allocInfo.allocationSize = memRequirements.size;
 	allocInfo.memoryTypeIndex = findMemoryType(context, memRequirements.memoryTypeBits, properties);
 
-	if (vkAllocateMemory(context->getDevice(), &allocInfo, nullptr, &imageMemory) != VK_SUCCESS) {
+	if (allocateMemory(context, allocInfo, imageMemory, getImageCategory(usage, category)) != VK_SUCCESS) {
 		throw std::runtime_error("failed to allocate image memory!");
 	}
 
@@ -109,7 +109,7 @@ void VulkanUtil::endSingleTimeCommands(VulkanContext* context, VkCommandBuffer c
 	vkFreeCommandBuffers(context->getDevice(), context->getCommandPool(), 1, &commandBuffer);
 }
 
-void VulkanUtil::createBuffer(VulkanContext* context, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory) {
+void VulkanUtil::createBuffer(VulkanContext* context, VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer& buffer, VkDeviceMemory& bufferMemory, MemoryCategory category) {
 	VkBufferCreateInfo bufferInfo{};
 	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
 	bufferInfo.size = size;
@@ -133,13 +133,56 @@ void VulkanUtil::createBuffer(VulkanContext* context, VkDeviceSize size, VkBuffe
 	allocInfo.memoryTypeIndex = VulkanUtil::findMemoryType(context, memRequirements.memoryTypeBits, properties);
 	allocInfo.pNext = &allocFlagsInfo;
 
-	if (vkAllocateMemory(context->getDevice(), &allocInfo, nullptr, &bufferMemory) != VK_SUCCESS) {
+	if (allocateMemory(context, allocInfo, bufferMemory, getBufferCategory(usage, category)) != VK_SUCCESS) {
 		throw std::runtime_error("failed to allocate buffer memory!");
 	}
 
 	vkBindBufferMemory(context->getDevice(), buffer, bufferMemory, 0);
 }
 
+VkResult VulkanUtil::allocateMemory(VulkanContext* context, const VkMemoryAllocateInfo& allocInfo, VkDeviceMemory& memory, MemoryCategory category) {
+	VkResult result = vkAllocateMemory(context->getDevice(), &allocInfo, nullptr, &memory);
+	if (result == VK_SUCCESS) {
+		context->getMemoryTracker()->trackAllocation(memory, allocInfo.allocationSize, allocInfo.memoryTypeIndex, category);
+	}
+	return result;
+}
+
+void VulkanUtil::freeMemory(VulkanContext* context, VkDeviceMemory memory) {
+	if (memory == VK_NULL_HANDLE) {
+		return;
+	}
+	context->getMemoryTracker()->trackFree(memory);
+	vkFreeMemory(context->getDevice(), memory, nullptr);
+}
+
+// category 를 따로 주지 않으면 usage 로 추정
+MemoryCategory VulkanUtil::getBufferCategory(VkBufferUsageFlags usage, MemoryCategory category) {
+	if (category != MemoryCategory::Auto) {
+		return category;
+	}
+	if (usage & VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR) {
+		return MemoryCategory::AccelerationStructure;
+	}
+	if (usage & (VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT)) {
+		return MemoryCategory::Geometry;
+	}
+	if ((usage & ~(VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT)) == 0) {
+		return MemoryCategory::Staging;
+	}
+	return MemoryCategory::Buffers;
+}
+
+MemoryCategory VulkanUtil::getImageCategory(VkImageUsageFlags usage, MemoryCategory category) {
+	if (category != MemoryCategory::Auto) {
+		return category;
+	}
+	if (usage & (VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT)) {
+		return MemoryCategory::RenderTargets;
+	}
+	return MemoryCategory::Textures;
+}
+
 VkDeviceAddress VulkanUtil::getDeviceAddress(VulkanContext* context, VkBuffer buffer) {
 	VkBufferDeviceAddressInfo addressInfo{};
 	addressInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
@@ -154,7 +197,10 @@ void VulkanUtil::copyBuffer(VulkanContext* context, VkBuffer srcBuffer, VkBuffer
 	copyRegion.srcOffset = 0;
 	copyRegion.dstOffset = 0;
 	copyRegion.size = size;
-	vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
+	{
+		GpuProfiler::Scope zone(context->getGpuProfiler(), commandBuffer, "upload");
+		vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
+	}
 
 	VulkanUtil::endSingleTimeCommands(context, commandBuffer);
 }
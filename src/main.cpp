@@ -1,11 +1,28 @@
 #include "include/App.h"
+#include "include/HeadlessApp.h"
 
-int main()
+int main(int argc, char** argv)
 {
 	std::cout << "start" << std::endl;
 	try {
-		App app;
-		app.run();
+		HeadlessSettings settings;
+		bool headless = HeadlessApp::parseCommandLine(argc, argv, settings);
+		// --trace 면 시작부터 기록 (아니면 Stats 창에서 켤 때부터)
+		CpuProfiler::setEnabled(!settings.tracePath.empty());
+		{
+			CpuProfiler::Scope zone("main");
+			if (headless) {
+				HeadlessApp app(settings);
+				app.run();
+			}
+			else {
+				App app(settings);
+				app.run();
+			}
+		}
+		if (!settings.tracePath.empty()) {
+			CpuProfiler::writeTrace(settings.tracePath);
+		}
 	}
 	catch (const std::exception& e) {
 		std::cerr << "Exception: " << e.what() << std::endl;
@@ -16,4 +33,4 @@ int main()
 		return EXIT_FAILURE;
 	}
 	return 0;
-}
\ No newline at end of file
+}